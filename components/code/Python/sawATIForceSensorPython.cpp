@@ -0,0 +1,407 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+// Python module exposing the shared memory ring published by
+// mtsATINetFTSensor as NumPy arrays without copies.  The ring is
+// exported with the buffer protocol as a read-only 1-D array of
+// structured elements (one per slot, see mtsATINetFTSharedMemory.h),
+// windows are slices of that array.  NumPy is imported at runtime, the
+// module only uses the CPython API.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <sawATIForceSensor/mtsATINetFTSharedMemoryReader.h>
+
+// struct module syntax for mtsATINetFTSharedMemorySlot, NumPy converts
+// it to a structured dtype with the same field names in lower case
+static const char * SlotFormat =
+    "T{<I:sequence:I:padding:Q:index:d:timestamp:"
+    "I:rdt_sequence:I:ft_sequence:I:status:I:flags:(6)d:force_torque:}";
+
+static_assert(sizeof(mtsATINetFTSharedMemorySlot) == 88,
+              "SlotFormat doesn't match mtsATINetFTSharedMemorySlot");
+
+typedef struct {
+    PyObject_HEAD
+    mtsATINetFTSharedMemoryReader * Reader;
+    Py_ssize_t Shape;
+    Py_ssize_t Stride;
+    Py_ssize_t NumberOfExports;
+} SharedMemoryObject;
+
+// numpy.asarray, imported on first use
+static PyObject * AsArray = 0;
+
+static bool CheckOpen(SharedMemoryObject * self)
+{
+    if (!self->Reader || !self->Reader->IsOpen()) {
+        PyErr_SetString(PyExc_ValueError, "shared memory is closed");
+        return false;
+    }
+    return true;
+}
+
+// PyArg "K" doesn't accept NumPy integers (e.g. window[0]['index'][0])
+static bool GetIndex(PyObject * args, uint64_t & index)
+{
+    PyObject * object;
+    if (!PyArg_ParseTuple(args, "O", &object)) {
+        return false;
+    }
+    PyObject * number = PyNumber_Index(object);
+    if (!number) {
+        return false;
+    }
+    index = PyLong_AsUnsignedLongLong(number);
+    Py_DECREF(number);
+    return !PyErr_Occurred();
+}
+
+// New array over all slots.  Arrays don't own the memory, the buffer
+// export keeps a reference on self until the array is deleted.
+static PyObject * GetArray(SharedMemoryObject * self)
+{
+    if (!AsArray) {
+        PyObject * numpy = PyImport_ImportModule("numpy");
+        if (!numpy) {
+            return 0;
+        }
+        AsArray = PyObject_GetAttrString(numpy, "asarray");
+        Py_DECREF(numpy);
+        if (!AsArray) {
+            return 0;
+        }
+    }
+    return PyObject_CallFunctionObjArgs(AsArray, reinterpret_cast<PyObject *>(self), 0);
+}
+
+// Oldest sample that can be returned.  The slot of sample count is
+// the next one the writer updates so it is never part of a window.
+static uint64_t GetOldest(SharedMemoryObject * self, const uint64_t count)
+{
+    const uint64_t available = self->Reader->GetCapacity() - 1;
+    return (count > available) ? (count - available) : 0;
+}
+
+// Samples [first, last) as a tuple of one or two views, oldest first.
+// The range wraps around the end of the ring when it crosses a
+// multiple of the capacity.
+static PyObject * GetParts(SharedMemoryObject * self, const uint64_t first, const uint64_t last)
+{
+    if (first == last) {
+        return PyTuple_New(0);
+    }
+    PyObject * array = GetArray(self);
+    if (!array) {
+        return 0;
+    }
+    const uint64_t capacity = self->Reader->GetCapacity();
+    const Py_ssize_t begin = static_cast<Py_ssize_t>(first % capacity);
+    const Py_ssize_t size = static_cast<Py_ssize_t>(last - first);
+    if (begin + size <= static_cast<Py_ssize_t>(capacity)) {
+        PyObject * part = PySequence_GetSlice(array, begin, begin + size);
+        Py_DECREF(array);
+        if (!part) {
+            return 0;
+        }
+        return Py_BuildValue("(N)", part);
+    }
+    PyObject * older = PySequence_GetSlice(array, begin, capacity);
+    PyObject * newer = PySequence_GetSlice(array, 0, begin + size - capacity);
+    Py_DECREF(array);
+    if (!older || !newer) {
+        Py_XDECREF(older);
+        Py_XDECREF(newer);
+        return 0;
+    }
+    return Py_BuildValue("(NN)", older, newer);
+}
+
+static int SharedMemory_init(SharedMemoryObject * self, PyObject * args, PyObject * kwargs)
+{
+    static const char * keywords[] = {"name", 0};
+    const char * name;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s", const_cast<char **>(keywords), &name)) {
+        return -1;
+    }
+    if (self->Reader) {
+        PyErr_SetString(PyExc_RuntimeError, "shared memory already opened");
+        return -1;
+    }
+    self->Reader = new mtsATINetFTSharedMemoryReader;
+    std::string errorMessage;
+    if (!self->Reader->Open(name, errorMessage)) {
+        delete self->Reader;
+        self->Reader = 0;
+        PyErr_SetString(PyExc_OSError, errorMessage.c_str());
+        return -1;
+    }
+    self->Shape = self->Reader->GetCapacity();
+    self->Stride = self->Reader->GetHeader()->SlotSize;
+    return 0;
+}
+
+static PyObject * SharedMemory_close(SharedMemoryObject * self, PyObject *)
+{
+    if (self->NumberOfExports > 0) {
+        PyErr_SetString(PyExc_BufferError, "cannot close shared memory while arrays are still using it");
+        return 0;
+    }
+    if (self->Reader) {
+        delete self->Reader;
+        self->Reader = 0;
+    }
+    Py_RETURN_NONE;
+}
+
+static void SharedMemory_dealloc(SharedMemoryObject * self)
+{
+    // arrays keep a reference on self so there are no exports left
+    if (self->Reader) {
+        delete self->Reader;
+    }
+    Py_TYPE(self)->tp_free(reinterpret_cast<PyObject *>(self));
+}
+
+static PyObject * SharedMemory_enter(SharedMemoryObject * self, PyObject *)
+{
+    Py_INCREF(self);
+    return reinterpret_cast<PyObject *>(self);
+}
+
+static PyObject * SharedMemory_exit(SharedMemoryObject * self, PyObject *)
+{
+    return SharedMemory_close(self, 0);
+}
+
+static PyObject * SharedMemory_window(SharedMemoryObject * self, PyObject * args)
+{
+    uint64_t size;
+    if (!GetIndex(args, size) || !CheckOpen(self)) {
+        return 0;
+    }
+    const uint64_t count = self->Reader->GetWriteCount();
+    const uint64_t oldest = GetOldest(self, count);
+    const uint64_t first = (count - oldest > size) ? (count - size) : oldest;
+    return GetParts(self, first, count);
+}
+
+static PyObject * SharedMemory_since(SharedMemoryObject * self, PyObject * args)
+{
+    uint64_t nextIndex;
+    if (!GetIndex(args, nextIndex) || !CheckOpen(self)) {
+        return 0;
+    }
+    const uint64_t count = self->Reader->GetWriteCount();
+    const uint64_t oldest = GetOldest(self, count);
+    uint64_t first = nextIndex;
+    uint64_t lost = 0;
+    if (first > count) {
+        // writer restarted, count starts from 0 again
+        first = oldest;
+    } else if (first < oldest) {
+        lost = oldest - first;
+        first = oldest;
+    }
+    PyObject * parts = GetParts(self, first, count);
+    if (!parts) {
+        return 0;
+    }
+    return Py_BuildValue("(NKK)", parts,
+                         static_cast<unsigned long long>(count),
+                         static_cast<unsigned long long>(lost));
+}
+
+static PyObject * SharedMemory_is_intact(SharedMemoryObject * self, PyObject * args)
+{
+    uint64_t firstIndex;
+    if (!GetIndex(args, firstIndex) || !CheckOpen(self)) {
+        return 0;
+    }
+    // the writer updates slot count % capacity next, the window is
+    // intact as long as it didn't reach the oldest sample
+    const uint64_t count = self->Reader->GetWriteCount();
+    return PyBool_FromLong(firstIndex + self->Reader->GetCapacity() > count);
+}
+
+static PyObject * SharedMemory_get_capacity(SharedMemoryObject * self, void *)
+{
+    if (!CheckOpen(self)) {
+        return 0;
+    }
+    return PyLong_FromUnsignedLong(self->Reader->GetCapacity());
+}
+
+static PyObject * SharedMemory_get_write_count(SharedMemoryObject * self, void *)
+{
+    if (!CheckOpen(self)) {
+        return 0;
+    }
+    return PyLong_FromUnsignedLongLong(self->Reader->GetWriteCount());
+}
+
+static PyObject * SharedMemory_get_writer_active(SharedMemoryObject * self, void *)
+{
+    if (!CheckOpen(self)) {
+        return 0;
+    }
+    return PyBool_FromLong(self->Reader->IsWriterActive());
+}
+
+static PyObject * SharedMemory_get_connected(SharedMemoryObject * self, void *)
+{
+    if (!CheckOpen(self)) {
+        return 0;
+    }
+    return PyBool_FromLong(self->Reader->IsConnected());
+}
+
+static PyObject * SharedMemory_get_ring(SharedMemoryObject * self, void *)
+{
+    if (!CheckOpen(self)) {
+        return 0;
+    }
+    return GetArray(self);
+}
+
+static int SharedMemory_getbuffer(SharedMemoryObject * self, Py_buffer * view, int flags)
+{
+    if (!CheckOpen(self)) {
+        view->obj = 0;
+        PyErr_SetString(PyExc_BufferError, "shared memory is closed");
+        return -1;
+    }
+    if (flags & PyBUF_WRITABLE) {
+        view->obj = 0;
+        PyErr_SetString(PyExc_BufferError, "shared memory is read-only");
+        return -1;
+    }
+    view->obj = reinterpret_cast<PyObject *>(self);
+    Py_INCREF(view->obj);
+    view->buf = const_cast<mtsATINetFTSharedMemorySlot *>(self->Reader->GetSlots());
+    view->len = self->Shape * self->Stride;
+    view->readonly = 1;
+    view->itemsize = self->Stride;
+    view->format = (flags & PyBUF_FORMAT) ? const_cast<char *>(SlotFormat) : 0;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) ? &(self->Shape) : 0;
+    view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES) ? &(self->Stride) : 0;
+    view->suboffsets = 0;
+    view->internal = 0;
+    self->NumberOfExports++;
+    return 0;
+}
+
+static void SharedMemory_releasebuffer(SharedMemoryObject * self, Py_buffer *)
+{
+    self->NumberOfExports--;
+}
+
+static PyMethodDef SharedMemory_methods[] = {
+    {"close", reinterpret_cast<PyCFunction>(SharedMemory_close), METH_NOARGS,
+     "Unmap the shared memory, fails if arrays from this object are still alive."},
+    {"__enter__", reinterpret_cast<PyCFunction>(SharedMemory_enter), METH_NOARGS, 0},
+    {"__exit__", reinterpret_cast<PyCFunction>(SharedMemory_exit), METH_VARARGS, 0},
+    {"window", reinterpret_cast<PyCFunction>(SharedMemory_window), METH_VARARGS,
+     "window(size) -> tuple of views\n\n"
+     "Most recent samples (at most size and capacity - 1), oldest first.\n"
+     "The tuple has two views if the window wraps around the ring."},
+    {"since", reinterpret_cast<PyCFunction>(SharedMemory_since), METH_VARARGS,
+     "since(next_index) -> (views, next_index, lost)\n\n"
+     "Samples published since next_index, oldest first, the index to use\n"
+     "for the next call and the number of samples overwritten before they\n"
+     "could be returned."},
+    {"is_intact", reinterpret_cast<PyCFunction>(SharedMemory_is_intact), METH_VARARGS,
+     "is_intact(first_index) -> bool\n\n"
+     "Views are not copies, the writer keeps updating the ring.  Call\n"
+     "after using a window starting at sample first_index (views[0]['index'][0])\n"
+     "to check that none of its samples were overwritten meanwhile."},
+    {0, 0, 0, 0}
+};
+
+static PyGetSetDef SharedMemory_getset[] = {
+    {const_cast<char *>("capacity"), reinterpret_cast<getter>(SharedMemory_get_capacity), 0,
+     const_cast<char *>("Number of slots in the ring."), 0},
+    {const_cast<char *>("write_count"), reinterpret_cast<getter>(SharedMemory_get_write_count), 0,
+     const_cast<char *>("Number of samples published so far, index of the next sample."), 0},
+    {const_cast<char *>("writer_active"), reinterpret_cast<getter>(SharedMemory_get_writer_active), 0,
+     const_cast<char *>("Sensor component still has the segment opened."), 0},
+    {const_cast<char *>("connected"), reinterpret_cast<getter>(SharedMemory_get_connected), 0,
+     const_cast<char *>("Sensor is connected."), 0},
+    {const_cast<char *>("ring"), reinterpret_cast<getter>(SharedMemory_get_ring), 0,
+     const_cast<char *>("Read-only NumPy array over all slots, in slot order."), 0},
+    {0, 0, 0, 0, 0}
+};
+
+static PyBufferProcs SharedMemory_as_buffer = {
+    reinterpret_cast<getbufferproc>(SharedMemory_getbuffer),
+    reinterpret_cast<releasebufferproc>(SharedMemory_releasebuffer)
+};
+
+static PyTypeObject SharedMemoryType = {
+    PyVarObject_HEAD_INIT(0, 0)
+};
+
+static PyModuleDef sawATIForceSensorPythonModule = {
+    PyModuleDef_HEAD_INIT,
+    "sawATIForceSensorPython",
+    "Zero-copy access to the shared memory ring published by mtsATINetFTSensor.",
+    -1,
+    0
+};
+
+PyMODINIT_FUNC PyInit_sawATIForceSensorPython(void)
+{
+    SharedMemoryType.tp_name = "sawATIForceSensorPython.SharedMemory";
+    SharedMemoryType.tp_doc =
+        "SharedMemory(name)\n\n"
+        "Map the shared memory ring published by the sensor component (-s option).\n"
+        "Supports the buffer protocol, numpy.asarray(shm) is a read-only view of\n"
+        "all slots with fields index, timestamp, rdt_sequence, ft_sequence, status,\n"
+        "flags and force_torque (6 values).";
+    SharedMemoryType.tp_basicsize = sizeof(SharedMemoryObject);
+    SharedMemoryType.tp_flags = Py_TPFLAGS_DEFAULT;
+    SharedMemoryType.tp_new = PyType_GenericNew;
+    SharedMemoryType.tp_init = reinterpret_cast<initproc>(SharedMemory_init);
+    SharedMemoryType.tp_dealloc = reinterpret_cast<destructor>(SharedMemory_dealloc);
+    SharedMemoryType.tp_methods = SharedMemory_methods;
+    SharedMemoryType.tp_getset = SharedMemory_getset;
+    SharedMemoryType.tp_as_buffer = &SharedMemory_as_buffer;
+    if (PyType_Ready(&SharedMemoryType) < 0) {
+        return 0;
+    }
+
+    PyObject * module = PyModule_Create(&sawATIForceSensorPythonModule);
+    if (!module) {
+        return 0;
+    }
+    Py_INCREF(&SharedMemoryType);
+    if (PyModule_AddObject(module, "SharedMemory", reinterpret_cast<PyObject *>(&SharedMemoryType)) < 0) {
+        Py_DECREF(&SharedMemoryType);
+        Py_DECREF(module);
+        return 0;
+    }
+    PyModule_AddIntConstant(module, "VALID", ATI_NETFT_SHM_VALID);
+    PyModule_AddIntConstant(module, "SATURATED", ATI_NETFT_SHM_SATURATED);
+    PyModule_AddIntConstant(module, "ERROR", ATI_NETFT_SHM_ERROR);
+    PyModule_AddIntConstant(module, "CONNECTED", ATI_NETFT_SHM_CONNECTED);
+    PyModule_AddIntConstant(module, "CONTACT", ATI_NETFT_SHM_CONTACT);
+    PyModule_AddIntConstant(module, "OVERLOAD", ATI_NETFT_SHM_OVERLOAD);
+    return module;
+}
@@ -0,0 +1,198 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <sawATIForceSensor/mtsATINetFTSharedMemoryReader.h>
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+mtsATINetFTSharedMemoryReader::mtsATINetFTSharedMemoryReader(void):
+    Size(0),
+    Header(0),
+    Slots(0)
+{
+}
+
+mtsATINetFTSharedMemoryReader::~mtsATINetFTSharedMemoryReader()
+{
+    Close();
+}
+
+bool mtsATINetFTSharedMemoryReader::Open(const std::string & name,
+                                         std::string & errorMessage)
+{
+    Close();
+    const std::string fullName = (!name.empty() && (name[0] == '/')) ? name : ("/" + name);
+    int fd = shm_open(fullName.c_str(), O_RDONLY, 0);
+    if (fd == -1) {
+        errorMessage = "shm_open failed for " + fullName + ": " + strerror(errno);
+        return false;
+    }
+    struct stat status;
+    if ((fstat(fd, &status) == -1)
+        || (static_cast<size_t>(status.st_size) < sizeof(mtsATINetFTSharedMemoryHeader))) {
+        errorMessage = "segment " + fullName + " is too small, writer may not be initialized yet";
+        close(fd);
+        return false;
+    }
+    void * memory = mmap(0, status.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        errorMessage = "mmap failed for " + fullName + ": " + strerror(errno);
+        return false;
+    }
+
+    const mtsATINetFTSharedMemoryHeader * header
+        = static_cast<const mtsATINetFTSharedMemoryHeader *>(memory);
+    std::string error;
+    if (memcmp(header->Magic, ATI_NETFT_SHM_MAGIC, sizeof(header->Magic)) != 0) {
+        error = "invalid magic, writer may not be initialized yet";
+    } else {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header->Version != ATI_NETFT_SHM_VERSION) {
+            error = "unsupported version";
+        } else if ((header->HeaderSize != sizeof(mtsATINetFTSharedMemoryHeader))
+                   || (header->SlotSize != sizeof(mtsATINetFTSharedMemorySlot))) {
+            error = "header or slot size mismatch, reader and writer compiled with different layouts";
+        } else if (mtsATINetFTSharedMemorySize(header->Capacity) > static_cast<size_t>(status.st_size)) {
+            error = "segment smaller than capacity";
+        }
+    }
+    if (!error.empty()) {
+        errorMessage = "segment " + fullName + ": " + error;
+        munmap(memory, status.st_size);
+        return false;
+    }
+
+    Size = status.st_size;
+    Header = header;
+    Slots = reinterpret_cast<const mtsATINetFTSharedMemorySlot *>(static_cast<const char *>(memory)
+                                                                  + sizeof(mtsATINetFTSharedMemoryHeader));
+    return true;
+}
+
+void mtsATINetFTSharedMemoryReader::Close(void)
+{
+    if (!Header) {
+        return;
+    }
+    munmap(const_cast<mtsATINetFTSharedMemoryHeader *>(Header), Size);
+    Header = 0;
+    Slots = 0;
+    Size = 0;
+}
+
+bool mtsATINetFTSharedMemoryReader::IsWriterActive(void) const
+{
+    return (Header->Status.load(std::memory_order_acquire) & ATI_NETFT_SHM_WRITER_ACTIVE);
+}
+
+bool mtsATINetFTSharedMemoryReader::IsConnected(void) const
+{
+    return (Header->Status.load(std::memory_order_acquire) & ATI_NETFT_SHM_CONNECTED);
+}
+
+uint32_t mtsATINetFTSharedMemoryReader::GetCapacity(void) const
+{
+    return Header->Capacity;
+}
+
+uint64_t mtsATINetFTSharedMemoryReader::GetWriteCount(void) const
+{
+    return Header->WriteCount.load(std::memory_order_acquire);
+}
+
+bool mtsATINetFTSharedMemoryReader::ReadSlot(const uint64_t index,
+                                             mtsATINetFTSharedMemorySample & sample) const
+{
+    const mtsATINetFTSharedMemorySlot & slot = Slots[index % Header->Capacity];
+    const uint32_t before = slot.Sequence.load(std::memory_order_acquire);
+    if (before & 1) {
+        return false;
+    }
+    sample = slot.Data;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint32_t after = slot.Sequence.load(std::memory_order_relaxed);
+    // same sequence and index means the copy is consistent and not from an older lap
+    return ((before == after) && (sample.Index == index));
+}
+
+bool mtsATINetFTSharedMemoryReader::GetLatest(mtsATINetFTSharedMemorySample & sample) const
+{
+    // the latest slot can only be overwritten if the writer wrapped
+    // around the whole ring, so retrying with the new latest index
+    // terminates quickly unless the writer stopped (or died) in the
+    // middle of an update
+    for (size_t retry = 0; retry < MaximumRetries; ++retry) {
+        const uint64_t count = GetWriteCount();
+        if (count == 0) {
+            return false;
+        }
+        if (ReadSlot(count - 1, sample)) {
+            return true;
+        }
+        if (!IsWriterActive()) {
+            return false;
+        }
+    }
+    return false;
+}
+
+bool mtsATINetFTSharedMemoryReader::Get(const uint64_t index,
+                                        mtsATINetFTSharedMemorySample & sample) const
+{
+    const uint64_t count = GetWriteCount();
+    if ((index >= count) || ((count - index) > Header->Capacity)) {
+        return false;
+    }
+    return ReadSlot(index, sample);
+}
+
+size_t mtsATINetFTSharedMemoryReader::GetSince(uint64_t & nextIndex,
+                                               mtsATINetFTSharedMemorySample * samples,
+                                               const size_t maxSamples,
+                                               uint64_t & lost) const
+{
+    lost = 0;
+    size_t copied = 0;
+    size_t failed = 0;
+    while (copied < maxSamples) {
+        const uint64_t count = GetWriteCount();
+        if (nextIndex >= count) {
+            break;
+        }
+        // keep one slot of margin, it might be the one being written
+        const uint64_t oldest = (count > (Header->Capacity - 1)) ? (count - (Header->Capacity - 1)) : 0;
+        if (nextIndex < oldest) {
+            lost += oldest - nextIndex;
+            nextIndex = oldest;
+        }
+        if (ReadSlot(nextIndex, samples[copied])) {
+            ++copied;
+            ++nextIndex;
+            failed = 0;
+        } else if (!IsWriterActive() || (++failed >= MaximumRetries)) {
+            break;
+        }
+    }
+    return copied;
+}
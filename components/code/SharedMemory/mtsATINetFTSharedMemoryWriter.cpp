@@ -0,0 +1,128 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <sawATIForceSensor/mtsATINetFTSharedMemoryWriter.h>
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+mtsATINetFTSharedMemoryWriter::mtsATINetFTSharedMemoryWriter(void):
+    Capacity(0),
+    Size(0),
+    Count(0),
+    Header(0),
+    Slots(0)
+{
+}
+
+mtsATINetFTSharedMemoryWriter::~mtsATINetFTSharedMemoryWriter()
+{
+    Close();
+}
+
+bool mtsATINetFTSharedMemoryWriter::Open(const std::string & name,
+                                         const uint32_t capacity,
+                                         std::string & errorMessage)
+{
+    Close();
+    if (name.empty() || (capacity < 2)) {
+        errorMessage = "name can't be empty and capacity must be at least 2";
+        return false;
+    }
+    Name = (name[0] == '/') ? name : ("/" + name);
+
+    // remove previous segment so readers still mapping it don't see our data
+    shm_unlink(Name.c_str());
+    int fd = shm_open(Name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd == -1) {
+        errorMessage = "shm_open failed for " + Name + ": " + strerror(errno);
+        return false;
+    }
+    Size = mtsATINetFTSharedMemorySize(capacity);
+    if (ftruncate(fd, Size) == -1) {
+        errorMessage = "ftruncate failed for " + Name + ": " + strerror(errno);
+        close(fd);
+        shm_unlink(Name.c_str());
+        return false;
+    }
+    void * memory = mmap(0, Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        errorMessage = "mmap failed for " + Name + ": " + strerror(errno);
+        shm_unlink(Name.c_str());
+        return false;
+    }
+    // touch all pages now so Publish never page faults
+    memset(memory, 0, Size);
+
+    Header = static_cast<mtsATINetFTSharedMemoryHeader *>(memory);
+    Slots = reinterpret_cast<mtsATINetFTSharedMemorySlot *>(static_cast<char *>(memory)
+                                                            + sizeof(mtsATINetFTSharedMemoryHeader));
+    Capacity = capacity;
+    Count = 0;
+    Header->Version = ATI_NETFT_SHM_VERSION;
+    Header->HeaderSize = sizeof(mtsATINetFTSharedMemoryHeader);
+    Header->SlotSize = sizeof(mtsATINetFTSharedMemorySlot);
+    Header->Capacity = capacity;
+    Header->WriteCount.store(0, std::memory_order_relaxed);
+    Header->Status.store(ATI_NETFT_SHM_WRITER_ACTIVE, std::memory_order_relaxed);
+    // magic last, readers check it to make sure the header is initialized
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(Header->Magic, ATI_NETFT_SHM_MAGIC, sizeof(Header->Magic));
+    return true;
+}
+
+void mtsATINetFTSharedMemoryWriter::Close(void)
+{
+    if (!Header) {
+        return;
+    }
+    Header->Status.store(0, std::memory_order_release);
+    munmap(Header, Size);
+    shm_unlink(Name.c_str());
+    Header = 0;
+    Slots = 0;
+    Capacity = 0;
+    Size = 0;
+}
+
+void mtsATINetFTSharedMemoryWriter::Publish(const mtsATINetFTSharedMemorySample & sample)
+{
+    mtsATINetFTSharedMemorySlot & slot = Slots[Count % Capacity];
+    const uint32_t sequence = slot.Sequence.load(std::memory_order_relaxed);
+    // odd sequence, readers will retry or skip this slot
+    slot.Sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.Data = sample;
+    slot.Data.Index = Count;
+    slot.Sequence.store(sequence + 2, std::memory_order_release);
+    ++Count;
+    Header->WriteCount.store(Count, std::memory_order_release);
+}
+
+void mtsATINetFTSharedMemoryWriter::SetConnected(const bool connected)
+{
+    Header->Status.store(connected ?
+                         (ATI_NETFT_SHM_WRITER_ACTIVE | ATI_NETFT_SHM_CONNECTED)
+                         : ATI_NETFT_SHM_WRITER_ACTIVE,
+                         std::memory_order_release);
+}
@@ -0,0 +1,310 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cmath>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <cisstCommon/cmnLogger.h>
+#include <sawATIForceSensor/mtsATINetFTCapture.h>
+
+namespace {
+    const char * AxisNames[6] = {"Fx", "Fy", "Fz", "Tx", "Ty", "Tz"};
+    const char * RateNames[6] = {"dFx/dt", "dFy/dt", "dFz/dt", "dTx/dt", "dTy/dt", "dTz/dt"};
+}
+
+mtsATINetFTCapture::mtsATINetFTCapture(void):
+    Current(0),
+    PreTrigger(0),
+    PostTrigger(0),
+    ForceThreshold(0.0),
+    TorqueThreshold(0.0),
+    Triggered(false),
+    ManualTrigger(false),
+    HasPrevious(false),
+    LastReason(""),
+    NumberOfTriggers(0),
+    NumberOfDropped(0),
+    WriterRunning(false)
+{
+    for (size_t i = 0; i < 6; ++i) {
+        AxisThresholds[i] = 0.0;
+        RateThresholds[i] = 0.0;
+    }
+}
+
+mtsATINetFTCapture::~mtsATINetFTCapture()
+{
+    Stop();
+    for (size_t i = 0; i < Rings.size(); ++i) {
+        delete Rings[i];
+    }
+}
+
+bool mtsATINetFTCapture::Configure(const size_t preTrigger, const size_t postTrigger,
+                                   const std::string & directory, const std::string & prefix,
+                                   const size_t numberOfRings)
+{
+    if (WriterRunning) {
+        CMN_LOG_INIT_ERROR << "mtsATINetFTCapture::Configure: can't configure while running" << std::endl;
+        return false;
+    }
+    if ((postTrigger == 0) || (numberOfRings == 0)) {
+        CMN_LOG_INIT_ERROR << "mtsATINetFTCapture::Configure: post trigger and number of rings must be at least 1"
+                           << std::endl;
+        return false;
+    }
+    PreTrigger = preTrigger;
+    PostTrigger = postTrigger;
+    Directory = directory.empty() ? "." : directory;
+    Prefix = prefix;
+    for (size_t i = 0; i < Rings.size(); ++i) {
+        delete Rings[i];
+    }
+    Rings.resize(numberOfRings);
+    for (size_t i = 0; i < numberOfRings; ++i) {
+        Rings[i] = new Ring;
+        Rings[i]->Samples.resize(PreTrigger + PostTrigger);
+        Rings[i]->State = RING_FREE;
+    }
+    Current = NextFreeRing();
+    return true;
+}
+
+void mtsATINetFTCapture::SetAxisThresholds(const double thresholds[6])
+{
+    for (size_t i = 0; i < 6; ++i) {
+        AxisThresholds[i] = thresholds[i];
+    }
+}
+
+void mtsATINetFTCapture::SetForceThreshold(const double threshold)
+{
+    ForceThreshold = threshold;
+}
+
+void mtsATINetFTCapture::SetTorqueThreshold(const double threshold)
+{
+    TorqueThreshold = threshold;
+}
+
+void mtsATINetFTCapture::SetRateThresholds(const double thresholds[6])
+{
+    for (size_t i = 0; i < 6; ++i) {
+        RateThresholds[i] = thresholds[i];
+    }
+}
+
+bool mtsATINetFTCapture::Start(void)
+{
+    if (!IsConfigured()) {
+        CMN_LOG_INIT_ERROR << "mtsATINetFTCapture::Start: not configured" << std::endl;
+        return false;
+    }
+    if (WriterRunning) {
+        return true;
+    }
+    WriterRunning = true;
+    WriterThread.Create<mtsATINetFTCapture, int>(this, &mtsATINetFTCapture::WriterLoop, 0, "ATICapture");
+    return true;
+}
+
+void mtsATINetFTCapture::Stop(void)
+{
+    if (!WriterRunning) {
+        return;
+    }
+    // save capture in progress, even if post trigger is incomplete
+    if (Current && Current->Reason) {
+        Current->State.store(RING_COMPLETE, std::memory_order_release);
+        Current = 0;
+    }
+    WriterRunning = false;
+    WriterSignal.Raise();
+    WriterThread.Wait();
+}
+
+void mtsATINetFTCapture::Trigger(void)
+{
+    ManualTrigger = true;
+}
+
+const char * mtsATINetFTCapture::CheckThresholds(const SampleType & sample)
+{
+    if (!(sample.Flags & ATI_NETFT_SHM_VALID)) {
+        HasPrevious = false;
+        return 0;
+    }
+    const double * ft = sample.ForceTorque;
+    const char * reason = 0;
+    for (size_t i = 0; (i < 6) && !reason; ++i) {
+        if ((AxisThresholds[i] > 0.0) && (std::fabs(ft[i]) > AxisThresholds[i])) {
+            reason = AxisNames[i];
+        }
+    }
+    if (!reason && (ForceThreshold > 0.0)
+        && ((ft[0] * ft[0] + ft[1] * ft[1] + ft[2] * ft[2]) > ForceThreshold * ForceThreshold)) {
+        reason = "|F|";
+    }
+    if (!reason && (TorqueThreshold > 0.0)
+        && ((ft[3] * ft[3] + ft[4] * ft[4] + ft[5] * ft[5]) > TorqueThreshold * TorqueThreshold)) {
+        reason = "|T|";
+    }
+    if (!reason && HasPrevious) {
+        const double dt = sample.Timestamp - Previous.Timestamp;
+        if (dt > 0.0) {
+            for (size_t i = 0; (i < 6) && !reason; ++i) {
+                if ((RateThresholds[i] > 0.0)
+                    && (std::fabs(ft[i] - Previous.ForceTorque[i]) > RateThresholds[i] * dt)) {
+                    reason = RateNames[i];
+                }
+            }
+        }
+    }
+    Previous = sample;
+    HasPrevious = true;
+    return reason;
+}
+
+mtsATINetFTCapture::Ring * mtsATINetFTCapture::NextFreeRing(void)
+{
+    for (size_t i = 0; i < Rings.size(); ++i) {
+        Ring * ring = Rings[i];
+        if (ring->State.load(std::memory_order_acquire) == RING_FREE) {
+            ring->Head = 0;
+            ring->Count = 0;
+            ring->Remaining = 0;
+            ring->Reason = 0;
+            ring->State.store(RING_RECORDING, std::memory_order_relaxed);
+            return ring;
+        }
+    }
+    return 0;
+}
+
+bool mtsATINetFTCapture::Add(const SampleType & sample)
+{
+    if (Rings.empty()) {
+        return false;
+    }
+    // rings are released by the writer thread
+    if (!Current) {
+        Current = NextFreeRing();
+    }
+
+    const char * reason = CheckThresholds(sample);
+    bool fire = reason && !Triggered;
+    Triggered = (reason != 0);
+    if (ManualTrigger) {
+        ManualTrigger = false;
+        fire = true;
+        reason = "manual";
+    }
+
+    if (!Current) {
+        if (fire) {
+            ++NumberOfDropped;
+        }
+        return false;
+    }
+
+    Ring & ring = *Current;
+    const size_t capacity = ring.Samples.size();
+    ring.Samples[ring.Head] = sample;
+    ring.Head = (ring.Head + 1) % capacity;
+    if (ring.Count < capacity) {
+        ++ring.Count;
+    }
+
+    // triggers during post trigger recording are part of the same capture
+    const bool started = fire && !ring.Reason;
+    if (started) {
+        ring.Reason = reason;
+        ring.Remaining = PostTrigger;
+        ring.Number = NumberOfTriggers;
+        ring.TriggerTime = sample.Timestamp;
+        ring.TriggerDate = std::time(0);
+        LastReason = reason;
+        ++NumberOfTriggers;
+    }
+    if (ring.Reason) {
+        --ring.Remaining;
+        if (ring.Remaining == 0) {
+            ring.State.store(RING_COMPLETE, std::memory_order_release);
+            Current = NextFreeRing();
+            WriterSignal.Raise();
+        }
+    }
+    return started;
+}
+
+void * mtsATINetFTCapture::WriterLoop(int)
+{
+    bool running = true;
+    while (running) {
+        WriterSignal.Wait(0.1);
+        // one last pass after Stop
+        running = WriterRunning;
+        for (size_t i = 0; i < Rings.size(); ++i) {
+            Ring & ring = *(Rings[i]);
+            if (ring.State.load(std::memory_order_acquire) == RING_COMPLETE) {
+                Save(ring);
+                ring.State.store(RING_FREE, std::memory_order_release);
+            }
+        }
+    }
+    return 0;
+}
+
+void mtsATINetFTCapture::Save(Ring & ring)
+{
+    char date[32];
+    std::strftime(date, sizeof(date), "%Y%m%d-%H%M%S", std::localtime(&ring.TriggerDate));
+    std::stringstream fileName;
+    fileName << Directory << "/" << Prefix << "-" << date << "-" << ring.Number << ".csv";
+
+    std::ofstream file(fileName.str().c_str());
+    if (!file.good()) {
+        CMN_LOG_RUN_ERROR << "mtsATINetFTCapture::Save: failed to open " << fileName.str() << std::endl;
+        return;
+    }
+    const size_t capacity = ring.Samples.size();
+    const size_t postTrigger = PostTrigger - ring.Remaining;
+    const size_t preTrigger = ring.Count - postTrigger;
+    file << "# trigger: " << ring.Reason << " at " << std::fixed << std::setprecision(6)
+         << ring.TriggerTime << " s, " << preTrigger << " samples before and "
+         << postTrigger << " samples from trigger" << std::endl
+         << "index,timestamp,rdt-sequence,ft-sequence,status,flags,fx,fy,fz,tx,ty,tz" << std::endl;
+    size_t position = (ring.Head + capacity - ring.Count) % capacity;
+    for (size_t i = 0; i < ring.Count; ++i) {
+        const SampleType & sample = ring.Samples[position];
+        file << sample.Index << "," << std::setprecision(6) << sample.Timestamp << ","
+             << sample.RdtSequence << "," << sample.FtSequence << ","
+             << sample.Status << "," << sample.Flags << std::setprecision(9);
+        for (size_t axis = 0; axis < 6; ++axis) {
+            file << "," << sample.ForceTorque[axis];
+        }
+        file << "\n";
+        position = (position + 1) % capacity;
+    }
+    file.close();
+    CMN_LOG_RUN_WARNING << "mtsATINetFTCapture::Save: capture triggered by " << ring.Reason
+                        << " saved in " << fileName.str() << std::endl;
+}
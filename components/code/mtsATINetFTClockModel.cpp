@@ -0,0 +1,194 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cmath>
+
+#include <sawATIForceSensor/mtsATINetFTClockModel.h>
+
+namespace {
+    // samples fitted before the model is used
+    const size_t MIN_SAMPLES = 64;
+    // sequence jump considered as a new stream (about 1 s at 7 kHz)
+    const int32_t MAX_SEQUENCE_GAP = 8192;
+    // packets later than this are not used, in seconds and residual RMS
+    const double MIN_LATE_THRESHOLD = 50.0e-6;
+    const double LATE_THRESHOLD_RMS = 4.0;
+    // restart when packets are this far from the line (seconds)...
+    const double MAX_RESIDUAL = 20.0e-3;
+    // ...or this many consecutive packets are not used
+    const size_t MAX_CONSECUTIVE_OUTLIERS = 1000;
+    // rebase when the origin is this many samples away
+    const double REBASE_SAMPLES = 65536.0;
+}
+
+mtsATINetFTClockModel::mtsATINetFTClockModel(void):
+    TimeConstant(10.0),
+    Latency(0.0),
+    NumberOfResets(0),
+    NumberOfLatePackets(0)
+{
+    Reset();
+}
+
+void mtsATINetFTClockModel::SetTimeConstant(const double timeConstant)
+{
+    if (timeConstant > 0.0) {
+        TimeConstant = timeConstant;
+    }
+}
+
+void mtsATINetFTClockModel::Reset(void)
+{
+    Initialized = false;
+    Locked = false;
+    LastSequence = 0;
+    LastReceiveTime = 0.0;
+    X = 0.0;
+    TimeOrigin = 0.0;
+    Sw = Sx = Sy = Sxx = Sxy = 0.0;
+    SquaredResiduals = 0.0;
+    NumberOfSamples = 0;
+    ConsecutiveOutliers = 0;
+}
+
+void mtsATINetFTClockModel::Restart(const uint32_t sequence, const double receiveTime)
+{
+    if (Initialized) {
+        ++NumberOfResets;
+    }
+    Reset();
+    Initialized = true;
+    LastSequence = sequence;
+    LastReceiveTime = receiveTime;
+    TimeOrigin = receiveTime;
+    Sw = 1.0;
+}
+
+bool mtsATINetFTClockModel::Fit(double & offset, double & slope) const
+{
+    const double determinant = Sw * Sxx - Sx * Sx;
+    if (determinant <= 0.0) {
+        return false;
+    }
+    slope = (Sw * Sxy - Sx * Sy) / determinant;
+    offset = (Sy - slope * Sx) / Sw;
+    return true;
+}
+
+void mtsATINetFTClockModel::Rebase(void)
+{
+    double offset, slope;
+    if (!Fit(offset, slope)) {
+        return;
+    }
+    // x' = x - d, y' = y - e with e on the fitted line
+    const double d = X;
+    const double e = offset + slope * d;
+    Sxx = Sxx - 2.0 * d * Sx + d * d * Sw;
+    Sxy = Sxy - d * Sy;
+    Sx = Sx - d * Sw;
+    Sxy = Sxy - e * Sx;
+    Sy = Sy - e * Sw;
+    X = 0.0;
+    TimeOrigin += e;
+}
+
+double mtsATINetFTClockModel::Update(const uint32_t sequence, const double receiveTime)
+{
+    // unsigned difference handles the 32 bits wrap around
+    const int32_t gap = static_cast<int32_t>(sequence - LastSequence);
+    if (!Initialized || (gap <= 0) || (gap > MAX_SEQUENCE_GAP)) {
+        Restart(sequence, receiveTime);
+        return receiveTime - Latency;
+    }
+    X += gap;
+    LastSequence = sequence;
+    const double y = receiveTime - TimeOrigin;
+
+    double offset, slope;
+    const bool fitted = Fit(offset, slope);
+    double result = receiveTime;
+    bool useForFit = true;
+    if (fitted && (NumberOfSamples >= MIN_SAMPLES)) {
+        const double predicted = offset + slope * X;
+        const double residual = y - predicted;
+        const double rms = GetJitter();
+        double lateThreshold = LATE_THRESHOLD_RMS * rms;
+        if (lateThreshold < MIN_LATE_THRESHOLD) {
+            lateThreshold = MIN_LATE_THRESHOLD;
+        }
+        if (residual > lateThreshold) {
+            // delays are only positive, late packets would bias the fit
+            useForFit = false;
+            ++NumberOfLatePackets;
+        }
+        if ((std::fabs(residual) > MAX_RESIDUAL)
+            || (!useForFit && (++ConsecutiveOutliers > MAX_CONSECUTIVE_OUTLIERS))) {
+            Restart(sequence, receiveTime);
+            return receiveTime - Latency;
+        }
+        if (useForFit) {
+            ConsecutiveOutliers = 0;
+        }
+        Locked = true;
+        result = TimeOrigin + predicted;
+    }
+
+    if (useForFit) {
+        // forget older samples based on the host time elapsed
+        const double decay = std::exp(-(receiveTime - LastReceiveTime) / TimeConstant);
+        Sw *= decay;
+        Sx *= decay;
+        Sy *= decay;
+        Sxx *= decay;
+        Sxy *= decay;
+        SquaredResiduals *= decay;
+        if (fitted) {
+            const double residual = y - (offset + slope * X);
+            SquaredResiduals += residual * residual;
+        }
+        Sw += 1.0;
+        Sx += X;
+        Sy += y;
+        Sxx += X * X;
+        Sxy += X * y;
+        LastReceiveTime = receiveTime;
+        ++NumberOfSamples;
+        if (X > REBASE_SAMPLES) {
+            Rebase();
+        }
+    }
+    return result - Latency;
+}
+
+double mtsATINetFTClockModel::GetPeriod(void) const
+{
+    double offset, slope;
+    if (!Locked || !Fit(offset, slope)) {
+        return 0.0;
+    }
+    return slope;
+}
+
+double mtsATINetFTClockModel::GetJitter(void) const
+{
+    if (Sw <= 1.0) {
+        return 0.0;
+    }
+    return std::sqrt(SquaredResiduals / (Sw - 1.0));
+}
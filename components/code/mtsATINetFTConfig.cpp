@@ -90,9 +90,9 @@ bool mtsATINetFTConfig::ParseCalibrationFile(const std::string & calFile)
     CalibInfo.Matrix.Row(0) = vctDoubleVec(StrToVec(Fx, ' '));
     CalibInfo.Matrix.Row(1) = vctDoubleVec(StrToVec(Fy, ' '));
     CalibInfo.Matrix.Row(2) = vctDoubleVec(StrToVec(Fz, ' '));
-    CalibInfo.Matrix.Row(3) = vctDoubleVec(StrToVec(Fx, ' '));
-    CalibInfo.Matrix.Row(4) = vctDoubleVec(StrToVec(Fy, ' '));
-    CalibInfo.Matrix.Row(5) = vctDoubleVec(StrToVec(Fz, ' '));
+    CalibInfo.Matrix.Row(3) = vctDoubleVec(StrToVec(Tx, ' '));
+    CalibInfo.Matrix.Row(4) = vctDoubleVec(StrToVec(Ty, ' '));
+    CalibInfo.Matrix.Row(5) = vctDoubleVec(StrToVec(Tz, ' '));
 
 
     // General info
@@ -0,0 +1,72 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <sawATIForceSensor/mtsATINetFTGaugeCalibration.h>
+#include <sawATIForceSensor/mtsATINetFTConfig.h>
+
+mtsATINetFTGaugeCalibration::mtsATINetFTGaugeCalibration(void)
+{
+    for (size_t column = 0; column < 6; ++column) {
+        for (size_t row = 0; row < 6; ++row) {
+            Transposed[column][row] = 0.0;
+        }
+        Offsets[column] = 0.0;
+    }
+}
+
+bool mtsATINetFTGaugeCalibration::Set(const mtsATINetFTConfig & config)
+{
+    const vctDoubleMat & matrix = config.CalibInfo.Matrix;
+    if ((matrix.rows() != 6) || (matrix.cols() != 6)) {
+        CMN_LOG_INIT_ERROR << "mtsATINetFTGaugeCalibration::Set: calibration matrix is not loaded" << std::endl;
+        return false;
+    }
+    double rowMajor[36];
+    for (size_t row = 0; row < 6; ++row) {
+        for (size_t column = 0; column < 6; ++column) {
+            rowMajor[row * 6 + column] = matrix.Element(row, column);
+        }
+    }
+    return Set(rowMajor, config.CalibInfo.GaugeOffsets.Pointer(),
+               config.GenInfo.CountsPerForce, config.GenInfo.CountsPerTorque);
+}
+
+bool mtsATINetFTGaugeCalibration::Set(const double matrix[36], const double offsets[6],
+                                      const double countsPerForce, const double countsPerTorque)
+{
+    if ((countsPerForce <= 0.0) || (countsPerTorque <= 0.0)) {
+        CMN_LOG_INIT_ERROR << "mtsATINetFTGaugeCalibration::Set: counts per force and torque must be positive"
+                           << std::endl;
+        return false;
+    }
+    for (size_t row = 0; row < 6; ++row) {
+        const double scale = 1.0 / ((row < 3) ? countsPerForce : countsPerTorque);
+        for (size_t column = 0; column < 6; ++column) {
+            Transposed[column][row] = scale * matrix[row * 6 + column];
+        }
+    }
+    SetOffsets(offsets);
+    return true;
+}
+
+void mtsATINetFTGaugeCalibration::SetOffsets(const double offsets[6])
+{
+    for (size_t column = 0; column < 6; ++column) {
+        Offsets[column] = offsets[column];
+    }
+}
@@ -0,0 +1,863 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <atomic>
+#include <cmath>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <cisstConfig.h>
+#include <cisstCommon/cmnPath.h>
+#include <cisstOSAbstraction/osaSleep.h>
+#include <cisstOSAbstraction/osaSocket.h>
+#include <cisstMultiTask/mtsInterfaceProvided.h>
+#include <cisstMultiTask/mtsManagerLocal.h>
+#include <cisstMultiTask/mtsVector.h>
+#include <cisstParameterTypes/prmForceCartesianGet.h>
+
+#include <sawATIForceSensor/mtsATINetFTMultiSensor.h>
+#include <sawATIForceSensor/mtsATINetFTClockModel.h>
+#include <sawATIForceSensor/mtsATINetFTConfig.h>
+#include <sawATIForceSensor/mtsATINetFTRawSample.h>
+#include <sawATIForceSensor/mtsATINetFTReceiver.h>
+#include <sawATIForceSensor/mtsATINetFTThread.h>
+#include <sawATIForceSensor/mtsATINetFTWatchdog.h>
+
+#if CISST_HAS_JSON
+#include <fstream>
+#include <json/json.h>
+#endif
+
+CMN_IMPLEMENT_SERVICES_DERIVED_ONEARG(mtsATINetFTMultiSensor, mtsTaskContinuous, mtsTaskContinuousConstructorArg)
+
+namespace {
+    const int ATI_PORT = 49152;
+    const uint16_t ATI_START_STREAMING = 0x0002;
+    const uint16_t ATI_STOP_STREAMING = 0x0000;
+    const uint16_t ATI_BIAS = 0x0042;
+    // datagrams read per sensor before checking the others
+    const int MAX_DATAGRAMS_PER_WAKEUP = 64;
+
+    inline double GetTime(void)
+    {
+        return mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime();
+    }
+}
+
+// state and interface of each sensor, commands are bound to this object
+class mtsATINetFTMultiSensor::Sensor
+{
+public:
+    Sensor(const std::string & name, const size_t index,
+           const mtsATINetFTReceiver::Protocol protocol, const size_t historyDepth):
+        Name(name),
+        Index(index),
+        Port(ATI_PORT),
+        Protocol(protocol),
+        UseCustomPort(protocol != mtsATINetFTReceiver::RDT),
+        Socket(osaSocket::UDP),
+        IsCalibFileLoaded(false),
+        StateTable(historyDepth, name),
+        RawSampleAccessor(0),
+        IsConnected(false),
+        LastReceiveTime(0.0),
+        LastRequestTime(-1.0e9),
+        NumberOfPackets(0),
+        NumberOfInvalidPackets(0),
+        UseClockModel(HasSequence()),
+        ClockPeriod(0.0),
+        ClockJitter(0.0),
+        IsStalled(false),
+        WatchdogInterval(0.0),
+        WatchdogThreshold(0.0),
+        NumberOfStalls(0),
+        NumberOfDisconnects(0)
+    {
+        StateTable.SetAutomaticAdvance(false);
+        RawSample.SetValid(false);
+        RawSample.SetAutomaticTimestamp(false);
+        StateTable.AddData(RawSample, "RawSample");
+        RawSampleAccessor = StateTable.GetAccessorByInstance(RawSample);
+    }
+
+    /*! Protocol numbers samples, see mtsATINetFTClockModel. */
+    inline bool HasSequence(void) const {
+        return (Protocol != mtsATINetFTReceiver::CUSTOM);
+    }
+
+    bool SendCommand(const uint16_t command) {
+        if (UseCustomPort) {
+            return true;
+        }
+        // see section 9.1 in Net F/T user manual, 0 samples for infinite streaming
+        unsigned char request[8];
+        const uint16_t header = htons(0x1234);
+        const uint16_t code = htons(command);
+        const uint32_t numberOfSamples = htonl(0);
+        memcpy(request, &header, 2);
+        memcpy(request + 2, &code, 2);
+        memcpy(request + 4, &numberOfSamples, 4);
+        return (Socket.Send(reinterpret_cast<const char *>(request), 8, 10.0 * cmn_ms) == 8);
+    }
+
+    /*! One state table row per packet, or an invalid row if packet is null. */
+    void Process(const mtsATINetFTPacket * packet) {
+        StateTable.Start();
+        uint32_t flags = 0;
+        if (packet) {
+            IsConnected = true;
+            LastReceiveTime = packet->ReceiveTime;
+            if (Watchdog.Sample(packet->ReceiveTime)) {
+                IsStalled.store(false, std::memory_order_relaxed);
+            }
+            WatchdogInterval.store(Watchdog.GetExpectedInterval(), std::memory_order_relaxed);
+            WatchdogThreshold.store(Watchdog.GetThreshold(), std::memory_order_relaxed);
+            ++NumberOfPackets;
+            for (size_t i = 0; i < 6; ++i) {
+                RawSample.Counts[i] = packet->Counts[i];
+            }
+            RawSample.CountsPerUnit = packet->CountsPerUnit;
+            RawSample.Status = packet->Status;
+            RawSample.RdtSequence = packet->RdtSequence;
+            RawSample.SetValid(!packet->Saturated && !packet->Error);
+            if (UseClockModel) {
+                RawSample.SetTimestamp(ClockModel.Update(packet->RdtSequence, packet->ReceiveTime));
+                ClockPeriod.store(ClockModel.GetPeriod(), std::memory_order_relaxed);
+                ClockJitter.store(ClockModel.GetJitter(), std::memory_order_relaxed);
+            } else {
+                RawSample.SetTimestamp(packet->ReceiveTime);
+            }
+            flags |= ATI_NETFT_SHM_CONNECTED;
+            if (packet->Saturated) {
+                flags |= ATI_NETFT_SHM_SATURATED;
+            }
+            if (packet->Error) {
+                flags |= ATI_NETFT_SHM_ERROR;
+            }
+        } else {
+            IsConnected = false;
+            RawSample.SetValid(false);
+            RawSample.SetTimestamp(GetTime());
+        }
+        if (RawSample.Valid()) {
+            flags |= ATI_NETFT_SHM_VALID;
+        }
+        RawSample.Flags = flags;
+        StateTable.Advance();
+    }
+
+    void Rebias(void) {
+        if (UseCustomPort) {
+            return;
+        }
+        if (!SendCommand(ATI_BIAS)) {
+            CMN_LOG_RUN_WARNING << "mtsATINetFTMultiSensor: Rebias UDP send failed for \"" << Name << "\"" << std::endl;
+            return;
+        }
+        ErrorMsg(std::string("Sensor ReBiased"));
+    }
+
+    // read commands, derived from the latest raw sample when called
+    void GetMeasuredCF(prmForceCartesianGet & forceTorque) const {
+        mtsATINetFTRawSample sample;
+        RawSampleAccessor->GetLatest(sample);
+        forceTorque.SetForce(sample.GetForceTorque());
+        forceTorque.SetValid(sample.Valid());
+        forceTorque.SetTimestamp(sample.Timestamp());
+    }
+
+    void GetRawData(mtsDoubleVec & forceTorque) const {
+        mtsATINetFTRawSample sample;
+        RawSampleAccessor->GetLatest(sample);
+        forceTorque.SetSize(6);
+        sample.GetForceTorque(forceTorque.Pointer());
+        forceTorque.SetValid(sample.Valid());
+        forceTorque.SetTimestamp(sample.Timestamp());
+    }
+
+    void GetPercentOfMax(mtsDoubleVec & percent) const {
+        mtsATINetFTRawSample sample;
+        RawSampleAccessor->GetLatest(sample);
+        percent.SetSize(6);
+        if (sample.HasFlag(ATI_NETFT_SHM_SATURATED) || sample.HasFlag(ATI_NETFT_SHM_ERROR)) {
+            percent.SetAll(100.0);
+        } else if (IsCalibFileLoaded) {
+            double forceTorque[6];
+            sample.GetForceTorque(forceTorque);
+            for (size_t i = 0; i < 6; ++i) {
+                percent[i] = 100.0 * std::fabs(forceTorque[i]) / Config.GenInfo.MaxRatings[i];
+            }
+        } else {
+            percent.SetAll(0.0);
+        }
+        percent.SetValid(sample.Valid());
+        percent.SetTimestamp(sample.Timestamp());
+    }
+
+    void GetIsConnected(bool & isConnected) const {
+        mtsATINetFTRawSample sample;
+        RawSampleAccessor->GetLatest(sample);
+        isConnected = sample.HasFlag(ATI_NETFT_SHM_CONNECTED);
+    }
+
+    void GetIsSaturated(bool & isSaturated) const {
+        mtsATINetFTRawSample sample;
+        RawSampleAccessor->GetLatest(sample);
+        isSaturated = sample.HasFlag(ATI_NETFT_SHM_SATURATED);
+    }
+
+    void GetClockModel(mtsDoubleVec & model) const {
+        model.SetSize(2);
+        model[0] = ClockPeriod.load(std::memory_order_relaxed);
+        model[1] = ClockJitter.load(std::memory_order_relaxed);
+    }
+
+    void GetIsStalled(bool & isStalled) const {
+        isStalled = IsStalled.load(std::memory_order_relaxed);
+    }
+
+    void GetWatchdog(mtsDoubleVec & watchdog) const {
+        watchdog.SetSize(4);
+        watchdog[0] = WatchdogInterval.load(std::memory_order_relaxed);
+        watchdog[1] = WatchdogThreshold.load(std::memory_order_relaxed);
+        watchdog[2] = static_cast<double>(NumberOfStalls.load(std::memory_order_relaxed));
+        watchdog[3] = static_cast<double>(NumberOfDisconnects.load(std::memory_order_relaxed));
+    }
+
+    void GetHasError(bool & hasError) const {
+        mtsATINetFTRawSample sample;
+        RawSampleAccessor->GetLatest(sample);
+        hasError = sample.HasFlag(ATI_NETFT_SHM_ERROR);
+    }
+
+    std::string Name;
+    size_t Index; // in Sensors and frames
+    std::string IP;
+    int Port;
+    mtsATINetFTReceiver::Protocol Protocol;
+    bool UseCustomPort;
+    osaSocket Socket;
+    mtsATINetFTConfig Config;
+    bool IsCalibFileLoaded;
+
+    mtsStateTable StateTable;
+    mtsATINetFTRawSample RawSample;
+    mtsStateTable::Accessor<mtsATINetFTRawSample> * RawSampleAccessor;
+    mtsFunctionWrite ErrorMsg;
+
+    bool IsConnected;
+    double LastReceiveTime;
+    double LastRequestTime;
+    size_t NumberOfPackets;
+    size_t NumberOfInvalidPackets;
+    char Buffer[512];
+
+    // sensor clock to host clock, see mtsATINetFTSensor::SetClockModel
+    bool UseClockModel;
+    mtsATINetFTClockModel ClockModel;
+    std::atomic<double> ClockPeriod;
+    std::atomic<double> ClockJitter;
+
+    // stall and disconnect detection, see mtsATINetFTSensor::SetStallWatchdog
+    mtsATINetFTWatchdog Watchdog;
+    mtsFunctionWrite Stalled;
+    mtsFunctionWrite Disconnected;
+    std::atomic<bool> IsStalled;
+    std::atomic<double> WatchdogInterval;
+    std::atomic<double> WatchdogThreshold;
+    std::atomic<size_t> NumberOfStalls;
+    std::atomic<size_t> NumberOfDisconnects;
+};
+
+mtsATINetFTMultiSensor::mtsATINetFTMultiSensor(const std::string & componentName):
+    mtsTaskContinuous(componentName)
+{
+    Init();
+}
+
+mtsATINetFTMultiSensor::mtsATINetFTMultiSensor(const mtsTaskContinuousConstructorArg & arg):
+    mtsTaskContinuous(arg)
+{
+    Init();
+}
+
+void mtsATINetFTMultiSensor::Init(void)
+{
+    EpollFileDescriptor = -1;
+    TimerFileDescriptor = -1;
+    SocketTimeout = 10.0 * cmn_ms;
+    ThreadCPU = -1;
+    ThreadPriority = 0;
+    FrameStateTable = 0;
+    FramePeriod = 0.0;
+    FrameMaxWait = 0.0;
+    NextFrameTime = 0.0;
+    NumberOfFrames = 0;
+    NumberOfLateFrames = 0;
+    NumberOfSkippedFrames = 0;
+
+    mtsInterfaceProvided * interfaceProvided = AddInterfaceProvided("ProvidesATINetFTMultiSensor");
+    if (interfaceProvided) {
+        interfaceProvided->AddCommandReadState(StateTable, StateTable.PeriodStats, "GetPeriodStatistics");
+    }
+}
+
+mtsATINetFTMultiSensor::~mtsATINetFTMultiSensor()
+{
+    if (EpollFileDescriptor >= 0) {
+        close(EpollFileDescriptor);
+    }
+    if (TimerFileDescriptor >= 0) {
+        close(TimerFileDescriptor);
+    }
+    for (size_t i = 0; i < Sensors.size(); ++i) {
+        Sensors[i]->Socket.Close();
+        delete Sensors[i];
+    }
+    delete FrameStateTable;
+}
+
+bool mtsATINetFTMultiSensor::AddSensor(const std::string & name,
+                                       const std::string & ip,
+                                       const std::string & protocol,
+                                       const int port,
+                                       const std::string & calibrationFile,
+                                       const size_t historyDepth)
+{
+    mtsATINetFTReceiver::Protocol receiveProtocol;
+    if (!mtsATINetFTReceiver::ProtocolFromString(protocol, receiveProtocol)) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddSensor: invalid protocol \"" << protocol << "\" for \""
+                                 << name << "\", must be \"rdt\", \"custom\" or \"custom-versioned\"" << std::endl;
+        return false;
+    }
+    if ((receiveProtocol != mtsATINetFTReceiver::RDT) && (port == 0)) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddSensor: port must be defined for protocol \"" << protocol
+                                 << "\" for \"" << name << "\"" << std::endl;
+        return false;
+    }
+    if (FrameStateTable) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddSensor: can't add sensor \"" << name
+                                 << "\" after SetFrames" << std::endl;
+        return false;
+    }
+    mtsInterfaceProvided * interfaceProvided = AddInterfaceProvided(name);
+    if (!interfaceProvided) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddSensor: failed to add interface for sensor \""
+                                 << name << "\", name already used?" << std::endl;
+        return false;
+    }
+
+    Sensor * sensor = new Sensor(name, Sensors.size(), receiveProtocol, historyDepth);
+    sensor->IP = ip;
+    if (port != 0) {
+        sensor->Port = port;
+    }
+    if (!calibrationFile.empty()) {
+        sensor->IsCalibFileLoaded = sensor->Config.LoadCalibrationFile(calibrationFile);
+        if (!sensor->IsCalibFileLoaded) {
+            CMN_LOG_CLASS_INIT_WARNING << "AddSensor: failed to load calibration file \""
+                                       << calibrationFile << "\" for \"" << name << "\"" << std::endl;
+        }
+    }
+    AddStateTable(&(sensor->StateTable));
+
+    interfaceProvided->AddCommandReadState(sensor->StateTable, sensor->StateTable.PeriodStats, "GetPeriodStatistics");
+    interfaceProvided->AddCommandReadState(sensor->StateTable, sensor->RawSample, "GetRawSample");
+    interfaceProvided->AddCommandRead(&Sensor::GetRawData, sensor, "GetRawData");
+    interfaceProvided->AddCommandRead(&Sensor::GetMeasuredCF, sensor, "measured_cf");
+    interfaceProvided->AddCommandRead(&Sensor::GetPercentOfMax, sensor, "GetPercentOfMax");
+    interfaceProvided->AddCommandRead(&Sensor::GetIsConnected, sensor, "GetIsConnected");
+    interfaceProvided->AddCommandRead(&Sensor::GetIsSaturated, sensor, "GetIsSaturated");
+    interfaceProvided->AddCommandRead(&Sensor::GetHasError, sensor, "GetHasError");
+    interfaceProvided->AddCommandRead(&Sensor::GetClockModel, sensor, "GetClockModel");
+    interfaceProvided->AddCommandRead(&Sensor::GetIsStalled, sensor, "GetIsStalled");
+    interfaceProvided->AddCommandRead(&Sensor::GetWatchdog, sensor, "GetWatchdog");
+    interfaceProvided->AddCommandVoid(&Sensor::Rebias, sensor, "Rebias");
+    interfaceProvided->AddEventWrite(sensor->ErrorMsg, "ErrorMsg", std::string(""));
+    interfaceProvided->AddEventWrite(sensor->Stalled, "Stalled", 0.0);
+    interfaceProvided->AddEventWrite(sensor->Disconnected, "Disconnected", 0.0);
+
+    Sensors.push_back(sensor);
+    CMN_LOG_CLASS_INIT_VERBOSE << "AddSensor: added sensor \"" << name << "\" (" << protocol
+                               << ", port " << sensor->Port << ")" << std::endl;
+    return true;
+}
+
+void mtsATINetFTMultiSensor::SetSocketTimeout(const double timeout)
+{
+    SocketTimeout = timeout;
+}
+
+void mtsATINetFTMultiSensor::SetClockModel(const bool enabled, const double timeConstant,
+                                           const double latency)
+{
+    for (size_t i = 0; i < Sensors.size(); ++i) {
+        Sensors[i]->UseClockModel = enabled && Sensors[i]->HasSequence();
+        Sensors[i]->ClockModel.SetTimeConstant(timeConstant);
+        Sensors[i]->ClockModel.SetLatency(latency);
+    }
+}
+
+void mtsATINetFTMultiSensor::SetStallWatchdog(const double missedIntervals)
+{
+    for (size_t i = 0; i < Sensors.size(); ++i) {
+        Sensors[i]->Watchdog.SetMissedIntervals(missedIntervals);
+    }
+}
+
+void mtsATINetFTMultiSensor::SetCPUAffinity(const int cpu)
+{
+    ThreadCPU = cpu;
+}
+
+void mtsATINetFTMultiSensor::SetRealTimePriority(const int priority)
+{
+    ThreadPriority = priority;
+}
+
+bool mtsATINetFTMultiSensor::SetFrames(const double rate,
+                                       const std::string & mode,
+                                       const double maxWait,
+                                       const size_t historyDepth)
+{
+    if (FrameStateTable) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetFrames: frames already configured" << std::endl;
+        return false;
+    }
+    if (Sensors.empty()) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetFrames: sensors must be added first" << std::endl;
+        return false;
+    }
+    if (rate <= 0.0) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetFrames: rate must be positive, not " << rate << std::endl;
+        return false;
+    }
+    if (maxWait < 0.0) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetFrames: maximum wait can't be negative" << std::endl;
+        return false;
+    }
+    mtsATINetFTSynchronizer::Mode frameMode;
+    if (!mtsATINetFTSynchronizer::ModeFromString(mode, frameMode)) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetFrames: invalid mode \"" << mode
+                                 << "\", must be \"interpolate\" or \"nearest\"" << std::endl;
+        return false;
+    }
+    mtsInterfaceProvided * interfaceProvided = AddInterfaceProvided("Frames");
+    if (!interfaceProvided) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetFrames: failed to add interface \"Frames\"" << std::endl;
+        return false;
+    }
+
+    FramePeriod = 1.0 / rate;
+    FrameMaxWait = maxWait;
+    // history must cover the wait at the highest sensor rate (7 kHz)
+    Synchronizer.Resize(Sensors.size(), static_cast<size_t>(std::ceil((maxWait + FramePeriod) * 7000.0)) + 16);
+    Synchronizer.SetMode(frameMode);
+
+    FrameForceTorque.SetSize(6 * Sensors.size());
+    FrameForceTorque.SetAll(0.0);
+    FrameForceTorque.SetValid(false);
+    FrameStateTable = new mtsStateTable(historyDepth, "Frames");
+    FrameStateTable->SetAutomaticAdvance(false);
+    FrameStateTable->AddData(FrameForceTorque, "FrameForceTorque");
+    FrameStateTable->AddData(FrameTime, "FrameTime");
+    FrameStateTable->AddData(FrameSkew, "FrameSkew");
+    AddStateTable(FrameStateTable);
+
+    interfaceProvided->AddCommandReadState(*FrameStateTable, FrameStateTable->PeriodStats, "GetPeriodStatistics");
+    interfaceProvided->AddCommandReadState(*FrameStateTable, FrameForceTorque, "GetFrame");
+    interfaceProvided->AddCommandReadState(*FrameStateTable, FrameTime, "GetFrameTime");
+    interfaceProvided->AddCommandReadState(*FrameStateTable, FrameSkew, "GetFrameSkew");
+    interfaceProvided->AddCommandRead(&mtsATINetFTMultiSensor::GetSensorNames, this, "GetSensorNames");
+
+    CMN_LOG_CLASS_INIT_VERBOSE << "SetFrames: " << rate << " Hz, " << mode << ", maximum wait "
+                               << maxWait << " s" << std::endl;
+    return true;
+}
+
+void mtsATINetFTMultiSensor::GetSensorNames(mtsStdStringVec & names) const
+{
+    names.SetSize(Sensors.size());
+    for (size_t i = 0; i < Sensors.size(); ++i) {
+        names[i] = Sensors[i]->Name;
+    }
+}
+
+void mtsATINetFTMultiSensor::Configure(const std::string & filename)
+{
+    if (!filename.empty()) {
+        ConfigureJSON(filename);
+    }
+}
+
+bool mtsATINetFTMultiSensor::ConfigureJSON(const std::string & filename)
+{
+#if CISST_HAS_JSON
+    std::ifstream jsonStream;
+    jsonStream.open(filename.c_str());
+    Json::Value jsonConfig, jsonValue;
+    Json::Reader jsonReader;
+    if (!jsonReader.parse(jsonStream, jsonConfig)) {
+        CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: failed to parse configuration file \""
+                                 << filename << "\"" << std::endl
+                                 << jsonReader.getFormattedErrorMessages();
+        return false;
+    }
+
+    // files are searched relative to the configuration file, then current directory
+    cmnPath configPath;
+    const size_t lastSeparator = filename.find_last_of("/\\");
+    if (lastSeparator != std::string::npos) {
+        configPath.Add(filename.substr(0, lastSeparator));
+    }
+    configPath.Add(cmnPath::GetWorkingDirectory());
+
+    jsonValue = jsonConfig["socket-timeout"];
+    if (!jsonValue.empty()) {
+        SetSocketTimeout(jsonValue.asDouble());
+    }
+
+    const Json::Value jsonThread = jsonConfig["thread"];
+    if (!jsonThread.empty()) {
+        SetCPUAffinity(jsonThread.get("cpu", -1).asInt());
+        SetRealTimePriority(jsonThread.get("priority", 0).asInt());
+    }
+
+    const Json::Value jsonSensors = jsonConfig["sensors"];
+    if (jsonSensors.empty()) {
+        CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: no \"sensors\" found in " << filename << std::endl;
+        return false;
+    }
+    for (Json::ArrayIndex index = 0; index < jsonSensors.size(); ++index) {
+        const Json::Value jsonSensor = jsonSensors[index];
+        const std::string name = jsonSensor.get("name", "").asString();
+        if (name.empty()) {
+            CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: \"name\" is required for each sensor in "
+                                     << filename << std::endl;
+            return false;
+        }
+        std::string calibrationFile = jsonSensor.get("calibration-file", "").asString();
+        if (!calibrationFile.empty()) {
+            const std::string fullPath = configPath.Find(calibrationFile);
+            if (fullPath.empty()) {
+                CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: can't find calibration file \""
+                                         << calibrationFile << "\" for sensor \"" << name << "\"" << std::endl;
+                return false;
+            }
+            calibrationFile = fullPath;
+        }
+        if (!AddSensor(name,
+                       jsonSensor.get("ip", "").asString(),
+                       jsonSensor.get("protocol", "rdt").asString(),
+                       jsonSensor.get("port", 0).asInt(),
+                       calibrationFile,
+                       jsonSensor.get("history-depth", 1000).asUInt())) {
+            return false;
+        }
+    }
+
+    const Json::Value jsonClockModel = jsonConfig["clock-model"];
+    if (!jsonClockModel.empty()) {
+        SetClockModel(jsonClockModel.get("enabled", true).asBool(),
+                      jsonClockModel.get("time-constant", 10.0).asDouble(),
+                      jsonClockModel.get("latency", 0.0).asDouble());
+    }
+
+    // number of missed intervals, 0 to disable
+    jsonValue = jsonConfig["stall-watchdog"];
+    if (!jsonValue.empty()) {
+        SetStallWatchdog(jsonValue.asDouble());
+    }
+
+    const Json::Value jsonFrames = jsonConfig["frames"];
+    if (!jsonFrames.empty()) {
+        if (!SetFrames(jsonFrames.get("rate", 0.0).asDouble(),
+                       jsonFrames.get("mode", "interpolate").asString(),
+                       jsonFrames.get("max-wait", 2.0 * cmn_ms).asDouble(),
+                       jsonFrames.get("history-depth", 1000).asUInt())) {
+            return false;
+        }
+    }
+    return true;
+#else
+    CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: cisst was compiled without JSON support, can't load "
+                             << filename << std::endl;
+    return false;
+#endif
+}
+
+void mtsATINetFTMultiSensor::Startup(void)
+{
+    mtsATINetFTConfigureCurrentThread(this->GetName(), ThreadCPU, ThreadPriority);
+
+    EpollFileDescriptor = epoll_create1(EPOLL_CLOEXEC);
+    if (EpollFileDescriptor < 0) {
+        CMN_LOG_CLASS_INIT_ERROR << "Startup: epoll_create1 failed, " << strerror(errno) << std::endl;
+        return;
+    }
+    // epoll_wait timeout is in milliseconds, deadlines use a timer
+    TimerFileDescriptor = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (TimerFileDescriptor >= 0) {
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.ptr = 0;
+        if (epoll_ctl(EpollFileDescriptor, EPOLL_CTL_ADD, TimerFileDescriptor, &event) != 0) {
+            close(TimerFileDescriptor);
+            TimerFileDescriptor = -1;
+        }
+    }
+    if (TimerFileDescriptor < 0) {
+        CMN_LOG_CLASS_INIT_WARNING << "Startup: failed to create timer, deadlines rounded to milliseconds" << std::endl;
+    }
+    for (size_t i = 0; i < Sensors.size(); ++i) {
+        Sensor * sensor = Sensors[i];
+        if (sensor->UseCustomPort) {
+            sensor->Socket.AssignPort(sensor->Port);
+        } else {
+            sensor->Socket.SetDestination(sensor->IP, sensor->Port);
+        }
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.ptr = sensor;
+        if (epoll_ctl(EpollFileDescriptor, EPOLL_CTL_ADD, sensor->Socket.GetIdentifier(), &event) != 0) {
+            CMN_LOG_CLASS_INIT_ERROR << "Startup: failed to add socket for sensor \"" << sensor->Name
+                                     << "\" to epoll, " << strerror(errno) << std::endl;
+        }
+    }
+    CMN_LOG_CLASS_INIT_VERBOSE << "Startup: " << Sensors.size() << " sensor(s) in one epoll thread" << std::endl;
+}
+
+void mtsATINetFTMultiSensor::StartStreaming(Sensor * sensor)
+{
+    sensor->LastRequestTime = GetTime();
+    if (!sensor->SendCommand(ATI_START_STREAMING)) {
+        CMN_LOG_CLASS_RUN_WARNING << "StartStreaming: UDP send failed for \"" << sensor->Name << "\"" << std::endl;
+    }
+}
+
+void mtsATINetFTMultiSensor::Run(void)
+{
+    ProcessQueuedCommands();
+
+    if ((EpollFileDescriptor < 0) || Sensors.empty()) {
+        osaSleep(SocketTimeout);
+        return;
+    }
+
+    const double now = GetTime();
+    for (size_t i = 0; i < Sensors.size(); ++i) {
+        Sensor * sensor = Sensors[i];
+        if (!sensor->IsConnected && (now - sensor->LastRequestTime >= SocketTimeout)) {
+            StartStreaming(sensor);
+        }
+    }
+
+    // don't sleep past the next deadline: frame, stall or socket timeout
+    double deadline = now + SocketTimeout;
+    if (FrameStateTable) {
+        if (NextFrameTime == 0.0) {
+            NextFrameTime = now + FramePeriod;
+        }
+        if (NextFrameTime + FrameMaxWait < deadline) {
+            deadline = NextFrameTime + FrameMaxWait;
+        }
+    }
+    for (size_t i = 0; i < Sensors.size(); ++i) {
+        const Sensor * sensor = Sensors[i];
+        if (!sensor->IsConnected) {
+            continue;
+        }
+        const double stall = sensor->Watchdog.GetDeadline();
+        if ((stall >= 0.0) && (stall < deadline)) {
+            deadline = stall;
+        }
+        if (sensor->LastReceiveTime + SocketTimeout < deadline) {
+            deadline = sensor->LastReceiveTime + SocketTimeout;
+        }
+    }
+    const double wait = (deadline > now) ? deadline - now : 0.0;
+
+    epoll_event events[16];
+    int timeout = static_cast<int>(std::ceil(wait * 1000.0));
+    if ((TimerFileDescriptor >= 0) && (wait > 0.0)) {
+        ArmTimer(wait);
+        // only a safety net, the timer wakes up epoll_wait
+        timeout += 1;
+    }
+    const int numberOfEvents = epoll_wait(EpollFileDescriptor, events, 16, timeout);
+    for (int i = 0; i < numberOfEvents; ++i) {
+        Sensor * sensor = static_cast<Sensor *>(events[i].data.ptr);
+        if (sensor) {
+            // decoder picked once per wake-up, not per datagram
+            switch (sensor->Protocol) {
+            case mtsATINetFTReceiver::CUSTOM:
+                DrainSensor<mtsATINetFTProtocolCustom>(sensor);
+                break;
+            case mtsATINetFTReceiver::CUSTOM_VERSIONED:
+                DrainSensor<mtsATINetFTProtocolCustomVersioned>(sensor);
+                break;
+            default:
+                DrainSensor<mtsATINetFTProtocolRDT>(sensor);
+            }
+        } else {
+            // clear the timer, number of expirations not used
+            uint64_t expirations;
+            if (read(TimerFileDescriptor, &expirations, sizeof(expirations)) < 0) {
+                continue;
+            }
+        }
+    }
+    const double end = GetTime();
+    CheckTimeouts(end);
+    if (FrameStateTable) {
+        ProcessFrames(end);
+    }
+}
+
+template <class _protocol>
+void mtsATINetFTMultiSensor::DrainSensor(Sensor * sensor)
+{
+    const int fd = sensor->Socket.GetIdentifier();
+    mtsATINetFTPacket packet;
+    // level triggered, datagrams left are reported by the next epoll_wait
+    for (int count = 0; count < MAX_DATAGRAMS_PER_WAKEUP; ++count) {
+        const int size = static_cast<int>(recv(fd, sensor->Buffer, sizeof(sensor->Buffer), MSG_DONTWAIT));
+        if (size < 0) {
+            return;
+        }
+        packet.ReceiveTime = GetTime();
+        if (_protocol::Decode(sensor->Buffer, size, packet)) {
+            sensor->Process(&packet);
+            if (FrameStateTable) {
+                double forceTorque[6];
+                sensor->RawSample.GetForceTorque(forceTorque);
+                Synchronizer.Add(sensor->Index, sensor->RawSample.Timestamp(),
+                                 forceTorque, sensor->RawSample.Valid());
+            }
+        } else {
+            ++(sensor->NumberOfInvalidPackets);
+        }
+    }
+}
+
+void mtsATINetFTMultiSensor::ArmTimer(const double wait)
+{
+    itimerspec timer;
+    memset(&timer, 0, sizeof(timer));
+    timer.it_value.tv_sec = static_cast<time_t>(wait);
+    timer.it_value.tv_nsec = static_cast<long>((wait - timer.it_value.tv_sec) * 1.0e9);
+    if ((timer.it_value.tv_sec == 0) && (timer.it_value.tv_nsec == 0)) {
+        timer.it_value.tv_nsec = 1;
+    }
+    timerfd_settime(TimerFileDescriptor, 0, &timer, 0);
+}
+
+void mtsATINetFTMultiSensor::CheckTimeouts(const double now)
+{
+    for (size_t i = 0; i < Sensors.size(); ++i) {
+        Sensor * sensor = Sensors[i];
+        if (sensor->Watchdog.Check(now)) {
+            sensor->IsStalled.store(true, std::memory_order_relaxed);
+            sensor->NumberOfStalls.fetch_add(1, std::memory_order_relaxed);
+            CMN_LOG_CLASS_RUN_WARNING << "CheckTimeouts: stream from \"" << sensor->Name
+                                      << "\" stalled, no sample for " << now - sensor->LastReceiveTime
+                                      << " s" << std::endl;
+            sensor->Stalled(now - sensor->LastReceiveTime);
+        }
+        if (sensor->IsConnected && (now - sensor->LastReceiveTime > SocketTimeout)) {
+            CMN_LOG_CLASS_RUN_WARNING << "CheckTimeouts: no data from \"" << sensor->Name
+                                      << "\" for " << now - sensor->LastReceiveTime << " s" << std::endl;
+            sensor->NumberOfDisconnects.fetch_add(1, std::memory_order_relaxed);
+            sensor->Disconnected(now - sensor->LastReceiveTime);
+            // rate might be different when the sensor comes back
+            sensor->Watchdog.Reset();
+            sensor->IsStalled.store(false, std::memory_order_relaxed);
+            sensor->Process(0);
+        }
+    }
+}
+
+void mtsATINetFTMultiSensor::ProcessFrames(const double now)
+{
+    // after a long stall, drop the frames older than the history
+    const double maxDelay = 10.0 * FramePeriod + FrameMaxWait;
+    if (now - NextFrameTime > maxDelay) {
+        const size_t skipped = static_cast<size_t>((now - NextFrameTime - FrameMaxWait) / FramePeriod);
+        NextFrameTime += skipped * FramePeriod;
+        NumberOfSkippedFrames += skipped;
+    }
+
+    while (now >= NextFrameTime) {
+        // wait for a sample after the frame time from each connected sensor
+        bool ready = true;
+        for (size_t i = 0; ready && (i < Sensors.size()); ++i) {
+            if (Sensors[i]->IsConnected && (Synchronizer.GetLatestTime(i) < NextFrameTime)) {
+                ready = false;
+            }
+        }
+        if (!ready) {
+            if (now < NextFrameTime + FrameMaxWait) {
+                return;
+            }
+            ++NumberOfLateFrames;
+        }
+        FrameStateTable->Start();
+        double skew;
+        const bool valid = Synchronizer.Match(NextFrameTime, SocketTimeout,
+                                              FrameForceTorque.Pointer(), skew);
+        FrameForceTorque.SetValid(valid);
+        FrameTime = NextFrameTime;
+        FrameSkew = skew;
+        FrameStateTable->Advance();
+        ++NumberOfFrames;
+        NextFrameTime += FramePeriod;
+    }
+}
+
+void mtsATINetFTMultiSensor::Cleanup(void)
+{
+    for (size_t i = 0; i < Sensors.size(); ++i) {
+        Sensor * sensor = Sensors[i];
+        sensor->SendCommand(ATI_STOP_STREAMING);
+        sensor->Socket.Close();
+        CMN_LOG_CLASS_INIT_VERBOSE << "Cleanup: sensor \"" << sensor->Name << "\" received "
+                                   << sensor->NumberOfPackets << " packets, "
+                                   << sensor->NumberOfInvalidPackets << " invalid" << std::endl;
+    }
+    if (FrameStateTable) {
+        CMN_LOG_CLASS_INIT_VERBOSE << "Cleanup: " << NumberOfFrames << " frames, "
+                                   << NumberOfLateFrames << " built after maximum wait, "
+                                   << NumberOfSkippedFrames << " skipped" << std::endl;
+    }
+    if (TimerFileDescriptor >= 0) {
+        close(TimerFileDescriptor);
+        TimerFileDescriptor = -1;
+    }
+    if (EpollFileDescriptor >= 0) {
+        close(EpollFileDescriptor);
+        EpollFileDescriptor = -1;
+    }
+}
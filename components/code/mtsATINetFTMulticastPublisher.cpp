@@ -0,0 +1,138 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <sawATIForceSensor/mtsATINetFTMulticastPublisher.h>
+
+mtsATINetFTMulticastPublisher::mtsATINetFTMulticastPublisher(void):
+    Socket(-1),
+    SamplesPerDatagram(7),
+    MaxDelay(2.0e-3),
+    Count(0),
+    FirstTimestamp(0.0),
+    Sequence(0),
+    NumberOfDatagrams(0),
+    NumberOfSendErrors(0)
+{
+    memset(&Destination, 0, sizeof(Destination));
+}
+
+mtsATINetFTMulticastPublisher::~mtsATINetFTMulticastPublisher()
+{
+    Close();
+}
+
+bool mtsATINetFTMulticastPublisher::Open(const std::string & group, const int port, const int ttl,
+                                         const std::string & interfaceAddress,
+                                         std::string & errorMessage)
+{
+    Close();
+    memset(&Destination, 0, sizeof(Destination));
+    Destination.sin_family = AF_INET;
+    Destination.sin_port = htons(static_cast<uint16_t>(port));
+    if ((inet_pton(AF_INET, group.c_str(), &Destination.sin_addr) != 1)
+        || !IN_MULTICAST(ntohl(Destination.sin_addr.s_addr))) {
+        errorMessage = "invalid IPv4 multicast address \"" + group + "\"";
+        return false;
+    }
+    Socket = socket(AF_INET, SOCK_DGRAM, 0);
+    if (Socket < 0) {
+        errorMessage = std::string("socket failed, ") + strerror(errno);
+        return false;
+    }
+    const unsigned char hops = static_cast<unsigned char>(ttl);
+    if (setsockopt(Socket, IPPROTO_IP, IP_MULTICAST_TTL, &hops, sizeof(hops)) != 0) {
+        errorMessage = std::string("failed to set multicast TTL, ") + strerror(errno);
+        Close();
+        return false;
+    }
+    if (!interfaceAddress.empty()) {
+        in_addr address;
+        if ((inet_pton(AF_INET, interfaceAddress.c_str(), &address) != 1)
+            || (setsockopt(Socket, IPPROTO_IP, IP_MULTICAST_IF, &address, sizeof(address)) != 0)) {
+            errorMessage = "failed to use interface \"" + interfaceAddress + "\" for multicast";
+            Close();
+            return false;
+        }
+    }
+    Count = 0;
+    return true;
+}
+
+void mtsATINetFTMulticastPublisher::Close(void)
+{
+    if (Socket >= 0) {
+        Flush();
+        close(Socket);
+        Socket = -1;
+    }
+}
+
+void mtsATINetFTMulticastPublisher::SetBatch(const size_t samplesPerDatagram, const double maxDelay)
+{
+    SamplesPerDatagram = samplesPerDatagram;
+    if (SamplesPerDatagram == 0) {
+        SamplesPerDatagram = 1;
+    } else if (SamplesPerDatagram > ATI_NETFT_MULTICAST_MAX_SAMPLES) {
+        SamplesPerDatagram = ATI_NETFT_MULTICAST_MAX_SAMPLES;
+    }
+    MaxDelay = maxDelay;
+}
+
+void mtsATINetFTMulticastPublisher::Add(const mtsATINetFTSharedMemorySample & sample)
+{
+    if (Socket < 0) {
+        return;
+    }
+    if (Count == 0) {
+        FirstTimestamp = sample.Timestamp;
+    }
+    mtsATINetFTMulticastEncodeSample(sample, Buffer + ATI_NETFT_MULTICAST_HEADER_SIZE
+                                     + Count * ATI_NETFT_MULTICAST_SAMPLE_SIZE);
+    ++Count;
+    if ((Count >= SamplesPerDatagram) || (sample.Timestamp - FirstTimestamp >= MaxDelay)) {
+        Flush();
+    }
+}
+
+void mtsATINetFTMulticastPublisher::Flush(void)
+{
+    if ((Count == 0) || (Socket < 0)) {
+        return;
+    }
+    mtsATINetFTMulticastHeader header;
+    header.Version = ATI_NETFT_MULTICAST_VERSION;
+    header.SampleSize = ATI_NETFT_MULTICAST_SAMPLE_SIZE;
+    header.Sequence = Sequence;
+    header.NumberOfSamples = static_cast<uint16_t>(Count);
+    mtsATINetFTMulticastEncodeHeader(header, Buffer);
+    const size_t size = ATI_NETFT_MULTICAST_HEADER_SIZE + Count * ATI_NETFT_MULTICAST_SAMPLE_SIZE;
+    if (sendto(Socket, Buffer, size, MSG_DONTWAIT,
+               reinterpret_cast<const sockaddr *>(&Destination), sizeof(Destination))
+        != static_cast<ssize_t>(size)) {
+        ++NumberOfSendErrors;
+    }
+    ++Sequence;
+    ++NumberOfDatagrams;
+    Count = 0;
+}
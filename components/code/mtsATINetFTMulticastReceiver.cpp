@@ -0,0 +1,444 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cmath>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cisstConfig.h>
+#include <cisstCommon/cmnPath.h>
+#include <cisstOSAbstraction/osaSleep.h>
+#include <cisstMultiTask/mtsInterfaceProvided.h>
+#include <cisstMultiTask/mtsManagerLocal.h>
+
+#include <sawATIForceSensor/mtsATINetFTMulticastReceiver.h>
+
+#if CISST_HAS_JSON
+#include <fstream>
+#include <json/json.h>
+#endif
+
+CMN_IMPLEMENT_SERVICES_DERIVED_ONEARG(mtsATINetFTMulticastReceiver, mtsTaskContinuous, mtsTaskContinuousConstructorArg)
+
+mtsATINetFTMulticastReceiver::mtsATINetFTMulticastReceiver(const std::string & componentName):
+    mtsTaskContinuous(componentName)
+{
+    Init();
+}
+
+mtsATINetFTMulticastReceiver::mtsATINetFTMulticastReceiver(const mtsTaskContinuousConstructorArg & arg):
+    mtsTaskContinuous(arg)
+{
+    Init();
+}
+
+mtsATINetFTMulticastReceiver::~mtsATINetFTMulticastReceiver()
+{
+    if (Socket >= 0) {
+        close(Socket);
+    }
+}
+
+void mtsATINetFTMulticastReceiver::Init(void)
+{
+    Group = "239.255.0.1";
+    Port = 49153;
+    Socket = -1;
+    SocketTimeout = 10.0 * cmn_ms;
+    UseSenderTimestamps = false;
+    IsConnected = false;
+    LastReceiveTime = 0.0;
+    IsCalibFileLoaded = false;
+    Bias.SetAll(0.0);
+    HasSequence = false;
+    LastSequence = 0;
+    LastIndex = 0;
+    NumberOfDatagrams = 0;
+    NumberOfLostDatagrams = 0;
+    NumberOfLostSamples = 0;
+    NumberOfReorderedDatagrams = 0;
+    NumberOfInvalidDatagrams = 0;
+    memset(&LatestSample, 0, sizeof(LatestSample));
+
+    // same state table content as the sensor component
+    RawSample.SetValid(false);
+    RawSample.SetAutomaticTimestamp(false);
+    StateTable.SetAutomaticAdvance(false);
+    StateTable.AddData(RawSample, "RawSample");
+    RawSampleAccessor = StateTable.GetAccessorByInstance(RawSample);
+
+    mtsInterfaceProvided * interfaceProvided = AddInterfaceProvided("ProvidesATINetFTSensor");
+    if (interfaceProvided) {
+        interfaceProvided->AddCommandReadState(StateTable, StateTable.PeriodStats, "GetPeriodStatistics");
+        interfaceProvided->AddCommandReadState(StateTable, RawSample, "GetRawSample");
+        interfaceProvided->AddCommandRead(&mtsATINetFTMulticastReceiver::GetRawData, this, "GetRawData");
+        interfaceProvided->AddCommandRead(&mtsATINetFTMulticastReceiver::GetMeasuredCF, this, "measured_cf");
+        interfaceProvided->AddCommandRead(&mtsATINetFTMulticastReceiver::GetIsConnected, this, "GetIsConnected");
+        interfaceProvided->AddCommandRead(&mtsATINetFTMulticastReceiver::GetIsSaturated, this, "GetIsSaturated");
+        interfaceProvided->AddCommandRead(&mtsATINetFTMulticastReceiver::GetPercentOfMax, this, "GetPercentOfMax");
+        interfaceProvided->AddCommandRead(&mtsATINetFTMulticastReceiver::GetHasError, this, "GetHasError");
+        interfaceProvided->AddCommandRead(&mtsATINetFTMulticastReceiver::GetIsInContact, this, "GetIsInContact");
+        interfaceProvided->AddCommandRead(&mtsATINetFTMulticastReceiver::GetIsOverloaded, this, "GetIsOverloaded");
+        interfaceProvided->AddCommandVoid(&mtsATINetFTMulticastReceiver::Rebias, this, "Rebias");
+        interfaceProvided->AddEventWrite(ErrorMsg, "ErrorMsg", std::string(""));
+    }
+}
+
+void mtsATINetFTMulticastReceiver::SetGroup(const std::string & group, const int port,
+                                            const std::string & interfaceAddress)
+{
+    Group = group;
+    Port = port;
+    InterfaceAddress = interfaceAddress;
+}
+
+void mtsATINetFTMulticastReceiver::SetSocketTimeout(const double timeout)
+{
+    SocketTimeout = timeout;
+}
+
+bool mtsATINetFTMulticastReceiver::LoadCalibrationFile(const std::string & filename)
+{
+    IsCalibFileLoaded = NetFTConfig.LoadCalibrationFile(filename);
+    if (!IsCalibFileLoaded) {
+        CMN_LOG_CLASS_INIT_WARNING << "LoadCalibrationFile: failed to load \"" << filename << "\"" << std::endl;
+    }
+    return IsCalibFileLoaded;
+}
+
+void mtsATINetFTMulticastReceiver::SetUseSenderTimestamps(const bool useSenderTimestamps)
+{
+    UseSenderTimestamps = useSenderTimestamps;
+}
+
+void mtsATINetFTMulticastReceiver::Configure(const std::string & filename)
+{
+    if (!filename.empty()) {
+        ConfigureJSON(filename);
+    }
+}
+
+bool mtsATINetFTMulticastReceiver::ConfigureJSON(const std::string & filename)
+{
+#if CISST_HAS_JSON
+    std::ifstream jsonStream;
+    jsonStream.open(filename.c_str());
+    Json::Value jsonConfig, jsonValue;
+    Json::Reader jsonReader;
+    if (!jsonReader.parse(jsonStream, jsonConfig)) {
+        CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: failed to parse configuration file \""
+                                 << filename << "\"" << std::endl
+                                 << jsonReader.getFormattedErrorMessages();
+        return false;
+    }
+
+    SetGroup(jsonConfig.get("group", Group).asString(),
+             jsonConfig.get("port", Port).asInt(),
+             jsonConfig.get("interface", InterfaceAddress).asString());
+
+    jsonValue = jsonConfig["socket-timeout"];
+    if (!jsonValue.empty()) {
+        SetSocketTimeout(jsonValue.asDouble());
+    }
+
+    jsonValue = jsonConfig["sender-timestamps"];
+    if (!jsonValue.empty()) {
+        SetUseSenderTimestamps(jsonValue.asBool());
+    }
+
+    jsonValue = jsonConfig["calibration-file"];
+    if (!jsonValue.empty()) {
+        // relative to the configuration file, then current directory
+        cmnPath configPath;
+        const size_t lastSeparator = filename.find_last_of("/\\");
+        if (lastSeparator != std::string::npos) {
+            configPath.Add(filename.substr(0, lastSeparator));
+        }
+        configPath.Add(cmnPath::GetWorkingDirectory());
+        const std::string calibrationFile = configPath.Find(jsonValue.asString());
+        if (calibrationFile.empty()) {
+            CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: can't find calibration file \""
+                                     << jsonValue.asString() << "\"" << std::endl;
+            return false;
+        }
+        LoadCalibrationFile(calibrationFile);
+    }
+    return true;
+#else
+    CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: cisst was compiled without JSON support, can't load "
+                             << filename << std::endl;
+    return false;
+#endif
+}
+
+void mtsATINetFTMulticastReceiver::Startup(void)
+{
+    Socket = socket(AF_INET, SOCK_DGRAM, 0);
+    if (Socket < 0) {
+        CMN_LOG_CLASS_INIT_ERROR << "Startup: socket failed, " << strerror(errno) << std::endl;
+        return;
+    }
+    // several receivers can run on the same computer
+    const int reuse = 1;
+    setsockopt(Socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<uint16_t>(Port));
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(Socket, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+        CMN_LOG_CLASS_INIT_ERROR << "Startup: failed to bind port " << Port << ", "
+                                 << strerror(errno) << std::endl;
+        close(Socket);
+        Socket = -1;
+        return;
+    }
+
+    ip_mreq membership;
+    memset(&membership, 0, sizeof(membership));
+    membership.imr_interface.s_addr = htonl(INADDR_ANY);
+    if ((inet_pton(AF_INET, Group.c_str(), &membership.imr_multiaddr) != 1)
+        || (!InterfaceAddress.empty()
+            && (inet_pton(AF_INET, InterfaceAddress.c_str(), &membership.imr_interface) != 1))
+        || (setsockopt(Socket, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) != 0)) {
+        CMN_LOG_CLASS_INIT_ERROR << "Startup: failed to join multicast group " << Group
+                                 << ", " << strerror(errno) << std::endl;
+        close(Socket);
+        Socket = -1;
+        return;
+    }
+    CMN_LOG_CLASS_INIT_VERBOSE << "Startup: receiving from multicast group " << Group << ":" << Port << std::endl;
+}
+
+void mtsATINetFTMulticastReceiver::Run(void)
+{
+    ProcessQueuedCommands();
+
+    if (Socket < 0) {
+        osaSleep(SocketTimeout);
+        return;
+    }
+
+    pollfd descriptor;
+    descriptor.fd = Socket;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+    const int timeout = static_cast<int>(std::ceil(SocketTimeout * 1000.0));
+    if (poll(&descriptor, 1, timeout) > 0) {
+        // read all datagrams available
+        ssize_t size;
+        while ((size = recv(Socket, Buffer, sizeof(Buffer), MSG_DONTWAIT)) > 0) {
+            const double receiveTime = mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime();
+            ProcessDatagram(Buffer, static_cast<size_t>(size), receiveTime);
+        }
+    }
+
+    const double now = mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime();
+    if (now - LastReceiveTime > SocketTimeout) {
+        if (IsConnected) {
+            CMN_LOG_CLASS_RUN_WARNING << "Run: no data from multicast group for "
+                                      << now - LastReceiveTime << " s" << std::endl;
+        }
+        ProcessSample(0, now);
+    }
+}
+
+void mtsATINetFTMulticastReceiver::ProcessDatagram(const char * buffer, const size_t size,
+                                                   const double receiveTime)
+{
+    mtsATINetFTMulticastHeader header;
+    if (!mtsATINetFTMulticastDecodeHeader(buffer, size, header)) {
+        ++NumberOfInvalidDatagrams;
+        return;
+    }
+    // signed difference so reordered or duplicated datagrams don't
+    // look like 4 billion lost ones, a large jump means the publisher
+    // restarted and its sequence started over
+    bool restarted = !HasSequence;
+    if (HasSequence) {
+        const int32_t difference = static_cast<int32_t>(header.Sequence - LastSequence);
+        if ((difference <= 0) && (difference > -REORDER_WINDOW)) {
+            ++NumberOfReorderedDatagrams;
+            return;
+        }
+        if ((difference > 0) && (difference <= REORDER_WINDOW)) {
+            NumberOfLostDatagrams += static_cast<size_t>(difference - 1);
+        } else {
+            restarted = true;
+        }
+    }
+    HasSequence = true;
+    LastSequence = header.Sequence;
+    ++NumberOfDatagrams;
+
+    mtsATINetFTSharedMemorySample sample;
+    for (uint16_t i = 0; i < header.NumberOfSamples; ++i) {
+        mtsATINetFTMulticastDecodeSample(buffer + ATI_NETFT_MULTICAST_HEADER_SIZE + i * header.SampleSize,
+                                         sample);
+        // index goes back when the publisher restarts, not a loss
+        if (IsConnected && !restarted && (sample.Index > LastIndex + 1)) {
+            NumberOfLostSamples += static_cast<size_t>(sample.Index - LastIndex - 1);
+        }
+        restarted = false;
+        LastIndex = sample.Index;
+        ProcessSample(&sample, receiveTime);
+    }
+}
+
+void mtsATINetFTMulticastReceiver::ProcessSample(const mtsATINetFTSharedMemorySample * sample,
+                                                 const double receiveTime)
+{
+    StateTable.Start();
+    if (sample) {
+        IsConnected = true;
+        LastReceiveTime = receiveTime;
+        LatestSample = *sample;
+        double forceTorque[6];
+        for (size_t i = 0; i < 6; ++i) {
+            forceTorque[i] = sample->ForceTorque[i] - Bias[i];
+        }
+        const bool inRange = RawSample.SetForceTorque(forceTorque);
+        RawSample.Status = sample->Status;
+        RawSample.RdtSequence = sample->RdtSequence;
+        RawSample.Flags = sample->Flags;
+        if (!inRange) {
+            RawSample.Flags |= ATI_NETFT_SHM_SATURATED;
+        }
+        RawSample.SetValid((sample->Flags & ATI_NETFT_SHM_VALID) != 0);
+        RawSample.SetTimestamp(UseSenderTimestamps ? sample->Timestamp : receiveTime);
+    } else {
+        IsConnected = false;
+        RawSample.Flags &= ~static_cast<uint32_t>(ATI_NETFT_SHM_CONNECTED | ATI_NETFT_SHM_VALID);
+        RawSample.SetValid(false);
+        RawSample.SetTimestamp(receiveTime);
+    }
+    StateTable.Advance();
+}
+
+void mtsATINetFTMulticastReceiver::Rebias(void)
+{
+    if (!IsConnected) {
+        CMN_LOG_CLASS_RUN_WARNING << "Rebias: no data received yet" << std::endl;
+        return;
+    }
+    for (size_t i = 0; i < 6; ++i) {
+        Bias[i] = LatestSample.ForceTorque[i];
+    }
+    ErrorMsg(std::string("Sensor ReBiased"));
+    CMN_LOG_CLASS_RUN_VERBOSE << "Rebias: local bias " << Bias << std::endl;
+}
+
+void mtsATINetFTMulticastReceiver::Cleanup(void)
+{
+    if (Socket >= 0) {
+        close(Socket);
+        Socket = -1;
+    }
+    CMN_LOG_CLASS_INIT_VERBOSE << "Cleanup: received " << NumberOfDatagrams << " datagrams, lost "
+                               << NumberOfLostDatagrams << " datagrams and " << NumberOfLostSamples
+                               << " samples, " << NumberOfReorderedDatagrams << " reordered or duplicated (ignored), "
+                               << NumberOfInvalidDatagrams << " invalid" << std::endl;
+}
+
+bool mtsATINetFTMulticastReceiver::GetLatestRawSample(mtsATINetFTRawSample & sample) const
+{
+    if (!RawSampleAccessor) {
+        return false;
+    }
+    return RawSampleAccessor->GetLatest(sample);
+}
+
+void mtsATINetFTMulticastReceiver::GetRawData(mtsDoubleVec & forceTorque) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    forceTorque.SetSize(6);
+    sample.GetForceTorque(forceTorque.Pointer());
+    forceTorque.SetValid(sample.Valid());
+    forceTorque.SetTimestamp(sample.Timestamp());
+}
+
+void mtsATINetFTMulticastReceiver::GetMeasuredCF(prmForceCartesianGet & forceTorque) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    forceTorque.SetForce(sample.GetForceTorque());
+    forceTorque.SetValid(sample.Valid());
+    forceTorque.SetTimestamp(sample.Timestamp());
+}
+
+void mtsATINetFTMulticastReceiver::GetPercentOfMax(mtsDoubleVec & percent) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    percent.SetSize(6);
+    if (sample.HasFlag(ATI_NETFT_SHM_SATURATED) || sample.HasFlag(ATI_NETFT_SHM_ERROR)) {
+        percent.SetAll(100.0);
+    } else if (IsCalibFileLoaded) {
+        double forceTorque[6];
+        sample.GetForceTorque(forceTorque);
+        for (size_t i = 0; i < 6; ++i) {
+            percent[i] = 100.0 * std::fabs(forceTorque[i]) / NetFTConfig.GenInfo.MaxRatings[i];
+        }
+    } else {
+        percent.SetAll(0.0);
+    }
+    percent.SetValid(sample.Valid());
+    percent.SetTimestamp(sample.Timestamp());
+}
+
+void mtsATINetFTMulticastReceiver::GetIsConnected(bool & isConnected) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    isConnected = sample.HasFlag(ATI_NETFT_SHM_CONNECTED);
+}
+
+void mtsATINetFTMulticastReceiver::GetIsSaturated(bool & isSaturated) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    isSaturated = sample.HasFlag(ATI_NETFT_SHM_SATURATED);
+}
+
+void mtsATINetFTMulticastReceiver::GetHasError(bool & hasError) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    hasError = sample.HasFlag(ATI_NETFT_SHM_ERROR);
+}
+
+void mtsATINetFTMulticastReceiver::GetIsInContact(bool & isInContact) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    isInContact = sample.HasFlag(ATI_NETFT_SHM_CONTACT);
+}
+
+void mtsATINetFTMulticastReceiver::GetIsOverloaded(bool & isOverloaded) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    isOverloaded = sample.HasFlag(ATI_NETFT_SHM_OVERLOAD);
+}
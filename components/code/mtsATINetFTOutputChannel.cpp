@@ -0,0 +1,138 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cmath>
+
+#include <cisstCommon/cmnConstants.h>
+#include <sawATIForceSensor/mtsATINetFTOutputChannel.h>
+
+mtsATINetFTOutputChannel::mtsATINetFTOutputChannel(const std::string & name,
+                                                   const unsigned int decimation,
+                                                   const double cutoffRatio,
+                                                   const size_t historyDepth):
+    Name(name),
+    Decimation((decimation > 0) ? decimation : 1),
+    CutoffRatio(((cutoffRatio > 0.0) && (cutoffRatio <= 1.0)) ? cutoffRatio : 0.5),
+    Counter(0),
+    Initialized(false)
+{
+    StateTable = new mtsStateTable(historyDepth, name);
+    StateTable->SetAutomaticAdvance(false);
+    ForceTorque.SetAutomaticTimestamp(false);
+    StateTable->AddData(ForceTorque, "ForceTorque");
+
+    ComputeCoefficients();
+    Reset();
+}
+
+mtsATINetFTOutputChannel::~mtsATINetFTOutputChannel()
+{
+    delete StateTable;
+}
+
+void mtsATINetFTOutputChannel::ComputeCoefficients(void)
+{
+    if (Decimation == 1) {
+        for (size_t section = 0; section < NUMBER_OF_SECTIONS; ++section) {
+            Sections[section].B0 = 1.0;
+            Sections[section].B1 = Sections[section].B2 = 0.0;
+            Sections[section].A1 = Sections[section].A2 = 0.0;
+        }
+        return;
+    }
+    // cutoff relative to input sampling frequency, bilinear transform
+    // of each pair of poles of a 4th order Butterworth
+    const double cutoff = CutoffRatio * 0.5 / static_cast<double>(Decimation);
+    const double K = std::tan(cmnPI * cutoff);
+    for (size_t section = 0; section < NUMBER_OF_SECTIONS; ++section) {
+        const double Q = 1.0 / (2.0 * std::cos(cmnPI * (2.0 * section + 1.0) / 8.0));
+        const double norm = 1.0 / (1.0 + K / Q + K * K);
+        Section & s = Sections[section];
+        s.B0 = K * K * norm;
+        s.B1 = 2.0 * s.B0;
+        s.B2 = s.B0;
+        s.A1 = 2.0 * (K * K - 1.0) * norm;
+        s.A2 = (1.0 - K / Q + K * K) * norm;
+    }
+}
+
+bool mtsATINetFTOutputChannel::SetFilter(const unsigned int decimation, const double cutoffRatio)
+{
+    if ((decimation == 0) || (cutoffRatio <= 0.0) || (cutoffRatio > 1.0)) {
+        return false;
+    }
+    Decimation = decimation;
+    CutoffRatio = cutoffRatio;
+    ComputeCoefficients();
+    Reset();
+    return true;
+}
+
+void mtsATINetFTOutputChannel::Reset(void)
+{
+    for (size_t section = 0; section < NUMBER_OF_SECTIONS; ++section) {
+        Sections[section].State1.SetAll(0.0);
+        Sections[section].State2.SetAll(0.0);
+    }
+    Output.SetAll(0.0);
+    Counter = 0;
+    Initialized = false;
+}
+
+void mtsATINetFTOutputChannel::Update(const mtsATINetFTSharedMemorySample & sample)
+{
+    const bool valid = (sample.Flags & ATI_NETFT_SHM_VALID);
+    if (valid) {
+        if (!Initialized) {
+            // start from steady state to avoid the filter's step
+            // response, each section has a unit DC gain
+            for (size_t section = 0; section < NUMBER_OF_SECTIONS; ++section) {
+                Section & s = Sections[section];
+                for (size_t i = 0; i < 6; ++i) {
+                    const double x = sample.ForceTorque[i];
+                    s.State1[i] = x - s.B0 * x;
+                    s.State2[i] = s.B2 * x - s.A2 * x;
+                }
+            }
+            Initialized = true;
+        }
+        for (size_t i = 0; i < 6; ++i) {
+            double x = sample.ForceTorque[i];
+            for (size_t section = 0; section < NUMBER_OF_SECTIONS; ++section) {
+                Section & s = Sections[section];
+                const double y = s.B0 * x + s.State1[i];
+                s.State1[i] = s.B1 * x - s.A1 * y + s.State2[i];
+                s.State2[i] = s.B2 * x - s.A2 * y;
+                x = y;
+            }
+            Output[i] = x;
+        }
+    }
+
+    ++Counter;
+    if (Counter < Decimation) {
+        return;
+    }
+    Counter = 0;
+
+    StateTable->Start();
+    ForceTorque.SetForce(Output);
+    ForceTorque.SetValid(valid);
+    ForceTorque.SetTimestamp(sample.Timestamp);
+    StateTable->Advance();
+}
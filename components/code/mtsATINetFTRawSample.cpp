@@ -0,0 +1,98 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstCommon/cmnSerializer.h>
+#include <sawATIForceSensor/mtsATINetFTRawSample.h>
+#include <sawATIForceSensor/mtsATINetFTProtocol.h>
+
+CMN_IMPLEMENT_SERVICES(mtsATINetFTRawSample);
+
+mtsATINetFTRawSample::mtsATINetFTRawSample(void):
+    mtsGenericObject(),
+    Status(0),
+    RdtSequence(0),
+    Flags(0),
+    CountsPerUnit(COUNTS_PER_UNIT)
+{
+    for (size_t i = 0; i < 6; ++i) {
+        Counts[i] = 0;
+    }
+}
+
+bool mtsATINetFTRawSample::SetForceTorque(const double * forceTorque)
+{
+    return mtsATINetFTToCounts(forceTorque, Counts, CountsPerUnit);
+}
+
+void mtsATINetFTRawSample::ToStream(std::ostream & outputStream) const
+{
+    mtsGenericObject::ToStream(outputStream);
+    outputStream << std::endl << "ForceTorque: " << GetForceTorque()
+                 << std::endl << "Status: 0x" << std::hex << Status << std::dec
+                 << " RdtSequence: " << RdtSequence
+                 << " Flags: 0x" << std::hex << Flags << std::dec;
+}
+
+void mtsATINetFTRawSample::ToStreamRaw(std::ostream & outputStream, const char delimiter,
+                                       bool headerOnly, const std::string & headerPrefix) const
+{
+    mtsGenericObject::ToStreamRaw(outputStream, delimiter, headerOnly, headerPrefix);
+    outputStream << delimiter;
+    if (headerOnly) {
+        outputStream << headerPrefix << "-fx" << delimiter
+                     << headerPrefix << "-fy" << delimiter
+                     << headerPrefix << "-fz" << delimiter
+                     << headerPrefix << "-tx" << delimiter
+                     << headerPrefix << "-ty" << delimiter
+                     << headerPrefix << "-tz" << delimiter
+                     << headerPrefix << "-status" << delimiter
+                     << headerPrefix << "-rdt-sequence" << delimiter
+                     << headerPrefix << "-flags";
+    } else {
+        for (size_t i = 0; i < 6; ++i) {
+            outputStream << static_cast<double>(Counts[i]) / CountsPerUnit << delimiter;
+        }
+        outputStream << Status << delimiter
+                     << RdtSequence << delimiter
+                     << Flags;
+    }
+}
+
+void mtsATINetFTRawSample::SerializeRaw(std::ostream & outputStream) const
+{
+    mtsGenericObject::SerializeRaw(outputStream);
+    for (size_t i = 0; i < 6; ++i) {
+        cmnSerializeRaw(outputStream, Counts[i]);
+    }
+    cmnSerializeRaw(outputStream, Status);
+    cmnSerializeRaw(outputStream, RdtSequence);
+    cmnSerializeRaw(outputStream, Flags);
+    cmnSerializeRaw(outputStream, CountsPerUnit);
+}
+
+void mtsATINetFTRawSample::DeSerializeRaw(std::istream & inputStream)
+{
+    mtsGenericObject::DeSerializeRaw(inputStream);
+    for (size_t i = 0; i < 6; ++i) {
+        cmnDeSerializeRaw(inputStream, Counts[i]);
+    }
+    cmnDeSerializeRaw(inputStream, Status);
+    cmnDeSerializeRaw(inputStream, RdtSequence);
+    cmnDeSerializeRaw(inputStream, Flags);
+    cmnDeSerializeRaw(inputStream, CountsPerUnit);
+}
@@ -0,0 +1,87 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstCommon/cmnLogger.h>
+#include <sawATIForceSensor/mtsATINetFTReceiveThread.h>
+#include <sawATIForceSensor/mtsATINetFTThread.h>
+
+mtsATINetFTReceiveThread::mtsATINetFTReceiveThread(const size_t queueSize):
+    Queue(queueSize),
+    Receiver(0),
+    ReceiveLoopMethod(0),
+    Timeout(0.1),
+    CPU(-1),
+    Priority(0),
+    Trace(0),
+    Track(0),
+    Running(false),
+    NumberOfPackets(0),
+    NumberOfDropped(0)
+{
+}
+
+mtsATINetFTReceiveThread::~mtsATINetFTReceiveThread()
+{
+    Stop();
+}
+
+bool mtsATINetFTReceiveThread::StartLoop(mtsATINetFTReceiver * receiver, const LoopMethod loop,
+                                         const double timeout, const int cpu, const int priority)
+{
+    if (!receiver) {
+        CMN_LOG_INIT_ERROR << "mtsATINetFTReceiveThread::StartLoop: receiver is null" << std::endl;
+        return false;
+    }
+    if (Running) {
+        return true;
+    }
+    Receiver = receiver;
+    ReceiveLoopMethod = loop;
+    Timeout = timeout;
+    CPU = cpu;
+    Priority = priority;
+    Running = true;
+    Thread.Create<mtsATINetFTReceiveThread, int>(this, &mtsATINetFTReceiveThread::Loop, 0, "ATIReceive");
+    return true;
+}
+
+void mtsATINetFTReceiveThread::Stop(void)
+{
+    if (!Running) {
+        return;
+    }
+    // the loop checks Running after each receive timeout
+    Running = false;
+    Thread.Wait();
+    Signal.Raise();
+}
+
+bool mtsATINetFTReceiveThread::Wait(const double timeout)
+{
+    return Signal.Wait(timeout);
+}
+
+void * mtsATINetFTReceiveThread::Loop(int)
+{
+    mtsATINetFTConfigureCurrentThread("ATIReceive", CPU, Priority);
+    if (Trace) {
+        Trace->SetTrackThread(Track);
+    }
+    (this->*ReceiveLoopMethod)();
+    return 0;
+}
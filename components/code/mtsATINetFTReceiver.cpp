@@ -0,0 +1,37 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <sawATIForceSensor/mtsATINetFTReceiver.h>
+
+mtsATINetFTReceiver::~mtsATINetFTReceiver()
+{
+}
+
+bool mtsATINetFTReceiver::ProtocolFromString(const std::string & name, Protocol & protocol)
+{
+    if (name == mtsATINetFTProtocolRDT::GetName()) {
+        protocol = RDT;
+    } else if (name == mtsATINetFTProtocolCustom::GetName()) {
+        protocol = CUSTOM;
+    } else if (name == mtsATINetFTProtocolCustomVersioned::GetName()) {
+        protocol = CUSTOM_VERSIONED;
+    } else {
+        return false;
+    }
+    return true;
+}
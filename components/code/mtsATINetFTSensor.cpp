@@ -17,11 +17,41 @@ http://www.cisst.org/cisst/license.txt.
 
 */
 
+#include <cmath>
+#include <sstream>
+
+#include <cisstConfig.h>
 #include <cisstCommon/cmnPortability.h>
 #include <cisstCommon/cmnConstants.h>
+#include <cisstCommon/cmnPath.h>
+#include <cisstOSAbstraction/osaSleep.h>
 #include <cisstMultiTask/mtsInterfaceProvided.h>
+#include <cisstMultiTask/mtsManagerLocal.h>
 
 #include <sawATIForceSensor/mtsATINetFTSensor.h>
+#include <sawATIForceSensor/mtsATINetFTRawSample.h>
+#include <sawATIForceSensor/mtsATINetFTOutputChannel.h>
+#include <sawATIForceSensor/mtsATINetFTStatistics.h>
+#include <sawATIForceSensor/mtsATINetFTCapture.h>
+#include <sawATIForceSensor/mtsATINetFTReceiveThread.h>
+#include <sawATIForceSensor/mtsATINetFTSource.h>
+#include <sawATIForceSensor/mtsATINetFTThread.h>
+#include <sawATIForceSensor/mtsATINetFTTrace.h>
+#include <sawATIForceSensor/sawATIForceSensorConfig.h>
+#if sawATIForceSensor_HAS_IO_URING
+#include <sawATIForceSensor/mtsATINetFTTransportIOUring.h>
+#endif
+
+#if (CISST_OS != CISST_WINDOWS)
+#include <sawATIForceSensor/mtsATINetFTSharedMemoryWriter.h>
+#include <sawATIForceSensor/mtsATINetFTMulticastPublisher.h>
+#include <sawATIForceSensor/mtsATINetFTTransportBusyPoll.h>
+#endif
+
+#if CISST_HAS_JSON
+#include <fstream>
+#include <json/json.h>
+#endif
 
 typedef unsigned int uint32;
 typedef int int32;
@@ -32,92 +62,633 @@ typedef unsigned char byte;
 class mtsATINetFTSensorData {
 public:
     uint16 Port;
-    uint32 RdtSequence;
-    uint32 FtSequence;
-    uint32 Status;
-
     byte Request[8];             /* The request data sent to the Net F/T. */
-    byte Response[36];			/* The raw response data received from the Net F/T. */
 };
 
+namespace {
+    // trace tracks, one per thread
+    const size_t TRACE_COMPONENT = 0;
+    const size_t TRACE_RECEIVE = 1;
+    // packets received and processed in one Run without the receive
+    // thread, queued commands are processed between batches
+    const size_t MAX_PACKETS_PER_RUN = 64;
+}
+
 #if (CISST_OS == CISST_LINUX)
 #include <netinet/in.h>
+#include <sys/socket.h>
 #elif (CISST_OS == CISST_WINDOWS)
 #include <Winsock2.h>
 #endif
 
-CMN_IMPLEMENT_SERVICES(mtsATINetFTSensor)
+CMN_IMPLEMENT_SERVICES_DERIVED_ONEARG(mtsATINetFTSensor, mtsTaskContinuous, mtsTaskContinuousConstructorArg)
 
-mtsATINetFTSensor::mtsATINetFTSensor(const std::string & componentName):
-    mtsTaskContinuous(componentName, 5000),
+mtsATINetFTSensor::mtsATINetFTSensor(const std::string & componentName,
+                                     const size_t historyDepth):
+    mtsTaskContinuous(componentName, historyDepth),
     ATI_PORT(49152),                 /* Port the Net F/T always uses */
     ATI_COMMAND(0x0002),             /* Command code 2 starts streaming */
-    ATI_NUM_SAMPLES(0),              /* Infinite streaming before stop streaming is sent */
-    Socket(osaSocket::UDP)
+    ATI_NUM_SAMPLES(0)               /* Infinite streaming before stop streaming is sent */
+{
+    Init();
+}
+
+mtsATINetFTSensor::mtsATINetFTSensor(const mtsTaskContinuousConstructorArg & arg):
+    mtsTaskContinuous(arg),
+    ATI_PORT(49152),
+    ATI_COMMAND(0x0002),
+    ATI_NUM_SAMPLES(0)
+{
+    Init();
+}
+
+void mtsATINetFTSensor::Init(void)
 {
     Data = new mtsATINetFTSensorData;
+    Socket = new osaSocket(osaSocket::UDP);
     IsSaturated = false;
+    HasError = false;
+    IsConnected = false;
+    ConfigurationFailed = false;
     IsCalibFileLoaded = false;
+    for (size_t i = 0; i < 6; ++i) {
+        MaxRatings[i] = 0.0;
+    }
+    UseCustomPort = false;
+    SocketTimeout = 10.0 * cmn_ms;
+    ReceiveProtocol = mtsATINetFTReceiver::RDT;
+    SendCommands = true;
+    ReceiveBufferSize = 0;
+    UseRawGauges = false;
+    HasGaugeOffsets = false;
+    CurrentFilter = NO_FILTER;
+    ThreadCPU = -1;
+    ThreadPriority = 0;
+    ThreadLockMemory = false;
+    ThreadPrefaultStackSize = 0;
+    SharedMemoryCapacity = 0;
+    SharedMemory = 0;
+    MulticastPort = 0;
+    MulticastSamplesPerDatagram = 7;
+    MulticastTTL = 1;
+    Multicast = 0;
+    Capture = 0;
+    Trace = 0;
+    DetectionSample.SetAutomaticTimestamp(false);
+    Receiver = 0;
+    ReceiverMethods.Counts = 0;
+    ReceiverMethods.RawGauges = 0;
+    ReceiverMethods.StartThread = 0;
+    ReceiveAndProcess = 0;
+    ReceiveThread = 0;
+    TransportType = "socket";
+    TransportLoop = false;
+    TransportSpeed = 1.0;
+    InjectionQueue = 0;
+    UseInjection = false;
+    ReceiveBackend = "osaSocket";
+    BusyPollTransport = 0;
+    BusyPollSpinTime = 1.0;
+    BusyPollYieldTime = 0.0;
+    BusyPollSocket = 50;
+    for (size_t i = 0; i < 3; ++i) {
+        BusyPollTimes[i] = 0.0;
+    }
+    UseReceiveThread = false;
+    ReceiveThreadCPU = -1;
+    ReceiveThreadPriority = 0;
+    ReceiveQueueSize = 1024;
+    ClockModelEnabled = true;
+    UseClockModel = true;
+    ClockPeriod = 0.0;
+    ClockJitter = 0.0;
+    ClockResets = 0;
+    ClockLatePackets = 0;
+    IsReceiving = false;
+    LastPacketTime = 0.0;
+    IsStalled = false;
+    WatchdogInterval = 0.0;
+    WatchdogThreshold = 0.0;
+    NumberOfStalls = 0;
+    NumberOfDisconnects = 0;
+    MeasuringInterruption = false;
+    InterruptionStart = 0.0;
+    NumberOfSourceSwitches = 0;
+    NumberOfFailedSwitches = 0;
+    LastInterruption = 0.0;
+    LongestInterruption = 0.0;
+    LastSwitchBlocking = 0.0;
+    OnDemand = false;
+    Streaming = STREAMING_STOPPED;
+    NumberOfSubscribers = 0;
+    BurstRemaining = 0;
+    BurstReceived = 0;
+    BurstChanged = false;
+    StreamingRequestTime = 0.0;
     Data->Port = ATI_PORT;
 
-    FTRawData.SetSize(6);
-    FTRawData.Zeros();
-
-    PercentOfMaxVec.SetSize(6);
-    PercentOfMaxVec.Zeros();
-
-    StateTable.AddData(FTRawData, "FTData");
-    StateTable.AddData(ForceTorque, "ForceTorque");
-    StateTable.AddData(IsConnected, "IsConnected");
-    StateTable.AddData(IsSaturated, "IsSaturated");
-    StateTable.AddData(HasError, "HasError");
-    StateTable.AddData(PercentOfMaxVec, "PercentOfMax");
+    // only the raw sample is stored, everything else is derived when read,
+    // one row per sample received (see ProcessSample)
+    // timestamp is the receive time or the sensor clock, see DecodePacket
+    RawSample.SetValid(false);
+    RawSample.SetAutomaticTimestamp(false);
+    StateTable.SetAutomaticAdvance(false);
+    StateTable.AddData(RawSample, "RawSample");
+    RawSampleAccessor = StateTable.GetAccessorByInstance(RawSample);
 
     mtsInterfaceProvided * interfaceProvided = AddInterfaceProvided("ProvidesATINetFTSensor");
     if (interfaceProvided) {
         interfaceProvided->AddCommandReadState(StateTable, StateTable.PeriodStats, "GetPeriodStatistics");
-        interfaceProvided->AddCommandReadState(StateTable, FTRawData, "GetRawData");
-        interfaceProvided->AddCommandReadState(StateTable, ForceTorque, "measured_cf");
-        interfaceProvided->AddCommandReadState(StateTable, IsConnected, "GetIsConnected");
-        interfaceProvided->AddCommandReadState(StateTable, IsSaturated, "GetIsSaturated");
-        interfaceProvided->AddCommandReadState(StateTable, PercentOfMaxVec, "GetPercentOfMax");
-        interfaceProvided->AddCommandReadState(StateTable, HasError, "GetHasError");
+        interfaceProvided->AddCommandReadState(StateTable, RawSample, "GetRawSample");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetRawData, this, "GetRawData");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetMeasuredCF, this, "measured_cf");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetMeasuredCFTool, this, "measured_cf_tool");
+        interfaceProvided->AddCommandRead(&mtsATINetFTToolTransform::Get, &ToolTransform, "GetToolTransform");
+        interfaceProvided->AddCommandWrite(&mtsATINetFTSensor::SetToolTransform, this, "SetToolTransform");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetIsConnected, this, "GetIsConnected");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetIsSaturated, this, "GetIsSaturated");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetPercentOfMax, this, "GetPercentOfMax");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetHasError, this, "GetHasError");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetIsInContact, this, "GetIsInContact");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetIsOverloaded, this, "GetIsOverloaded");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetBusyPollTimes, this, "GetBusyPollTimes");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetClockModel, this, "GetClockModel");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetIsStalled, this, "GetIsStalled");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetWatchdog, this, "GetWatchdog");
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetStreamingState, this, "GetStreamingState");
+        interfaceProvided->AddCommandWrite(&mtsATINetFTSensor::RequestSamples, this, "RequestSamples");
+        interfaceProvided->AddCommandVoid(&mtsATINetFTSensor::Subscribe, this, "Subscribe");
+        interfaceProvided->AddCommandVoid(&mtsATINetFTSensor::Unsubscribe, this, "Unsubscribe");
 
         interfaceProvided->AddCommandVoid(&mtsATINetFTSensor::Rebias, this, "Rebias");
+        interfaceProvided->AddCommandVoid(&mtsATINetFTSensor::TriggerCapture, this, "TriggerCapture");
+        interfaceProvided->AddCommandWrite(&mtsATINetFTSensor::SaveTrace, this, "SaveTrace", std::string(""));
         interfaceProvided->AddCommandWrite(&mtsATINetFTSensor::SetFilter, this, "SetFilter", std::string(""));
+        interfaceProvided->AddCommandWrite(&mtsATINetFTSensor::Reconfigure, this, "Reconfigure", std::string(""));
+        interfaceProvided->AddCommandWrite(&mtsATINetFTSensor::SetSocketTimeout, this, "SetSocketTimeout", 0.0);
+        interfaceProvided->AddCommandWrite(&mtsATINetFTSensor::LoadCalibrationFile, this, "LoadCalibrationFile", std::string(""));
+        interfaceProvided->AddCommandRead(&mtsATINetFTSensor::GetReconfiguration, this, "GetReconfiguration");
         interfaceProvided->AddEventWrite(EventTriggers.ErrorMsg, "ErrorMsg", std::string(""));
+        interfaceProvided->AddEventWrite(EventTriggers.ContactDetected, "ContactDetected", prmForceCartesianGet());
+        interfaceProvided->AddEventWrite(EventTriggers.ContactLost, "ContactLost", prmForceCartesianGet());
+        interfaceProvided->AddEventWrite(EventTriggers.OverloadDetected, "OverloadDetected", prmForceCartesianGet());
+        interfaceProvided->AddEventWrite(EventTriggers.OverloadCleared, "OverloadCleared", prmForceCartesianGet());
+        interfaceProvided->AddEventWrite(EventTriggers.Stalled, "Stalled", 0.0);
+        interfaceProvided->AddEventWrite(EventTriggers.Disconnected, "Disconnected", 0.0);
+        interfaceProvided->AddEventWrite(EventTriggers.BurstCompleted, "BurstCompleted", 0);
+        interfaceProvided->AddEventWrite(EventTriggers.CaptureTriggered, "CaptureTriggered", std::string(""));
+    }
+}
+
+mtsATINetFTSensor::~mtsATINetFTSensor()
+{
+    Socket->Close();
+#if (CISST_OS != CISST_WINDOWS)
+    delete Multicast;
+    delete SharedMemory;
+#endif
+    for (size_t i = 0; i < OutputChannels.size(); ++i) {
+        delete OutputChannels[i];
+    }
+    for (size_t i = 0; i < StatisticsWindows.size(); ++i) {
+        delete StatisticsWindows[i];
     }
+    delete Capture;
+    delete Trace;
+    delete ReceiveThread;
+    delete Receiver;
+    delete InjectionQueue.load();
+    delete Socket;
+    delete Data;
 }
 
 void mtsATINetFTSensor::Startup(void)
 {
-    if(UseCustomPort) {
-        Socket.AssignPort(Data->Port);
+    if (ConfigurationFailed) {
+        CMN_LOG_CLASS_INIT_ERROR << "Startup: configuration failed, sensor not started" << std::endl;
+        EventTriggers.ErrorMsg(std::string("Startup: configuration failed, sensor not started"));
+        return;
+    }
+    ConfigureThread();
+    ReportMemoryBudget();
+
+    if (Trace) {
+        Trace->SetTrackName(TRACE_COMPONENT, GetName());
+        Trace->SetTrackName(TRACE_RECEIVE, GetName() + " receive");
+        Trace->SetTrackThread(TRACE_COMPONENT);
+        Trace->Start();
+    }
+
+    OpenSource();
+    ConfigureGaugeCalibration();
+
+    if (OnDemand && !SendCommands) {
+        CMN_LOG_CLASS_INIT_WARNING << "Startup: \"on-demand\" acquisition mode requires the rdt protocol, using \"continuous\"" << std::endl;
+        OnDemand = false;
+    }
+
+    // also picks the receive method for the source and decoder
+    StartReceiveThread();
+    if (UseReceiveThread) {
+        CMN_LOG_CLASS_INIT_VERBOSE << "Startup: receiving in dedicated thread, queue size "
+                                   << ReceiveQueueSize << std::endl;
+    }
+
+    if (Capture) {
+        Capture->Start();
+    }
+
+    if (!SharedMemoryName.empty()) {
+#if (CISST_OS != CISST_WINDOWS)
+        if (!SharedMemory) {
+            SharedMemory = new mtsATINetFTSharedMemoryWriter;
+        }
+        std::string errorMessage;
+        if (SharedMemory->Open(SharedMemoryName, SharedMemoryCapacity, errorMessage)) {
+            CMN_LOG_CLASS_INIT_VERBOSE << "Startup: publishing samples in shared memory \""
+                                       << SharedMemory->GetName() << "\" with "
+                                       << SharedMemoryCapacity << " slots" << std::endl;
+        } else {
+            CMN_LOG_CLASS_INIT_ERROR << "Startup: failed to create shared memory, "
+                                     << errorMessage << std::endl;
+        }
+#else
+        CMN_LOG_CLASS_INIT_ERROR << "Startup: shared memory is not supported on this platform" << std::endl;
+#endif
+    }
+
+    if (!MulticastGroup.empty()) {
+#if (CISST_OS != CISST_WINDOWS)
+        if (!Multicast) {
+            Multicast = new mtsATINetFTMulticastPublisher;
+        }
+        Multicast->SetBatch(MulticastSamplesPerDatagram, 2.0 * cmn_ms);
+        std::string errorMessage;
+        if (Multicast->Open(MulticastGroup, MulticastPort, MulticastTTL, MulticastInterface, errorMessage)) {
+            CMN_LOG_CLASS_INIT_VERBOSE << "Startup: publishing samples to multicast group "
+                                       << MulticastGroup << ":" << MulticastPort << ", "
+                                       << MulticastSamplesPerDatagram << " samples per datagram" << std::endl;
+        } else {
+            CMN_LOG_CLASS_INIT_ERROR << "Startup: failed to open multicast publisher, "
+                                     << errorMessage << std::endl;
+        }
+#else
+        CMN_LOG_CLASS_INIT_ERROR << "Startup: multicast is not supported on this platform" << std::endl;
+#endif
+    }
+}
+
+void mtsATINetFTSensor::Configure(const std::string & filename)
+{
+    Configure(filename, 10.0 * cmn_ms, 0);
+}
+
+bool mtsATINetFTSensor::ConfigureJSON(const std::string & filename)
+{
+#if CISST_HAS_JSON
+    std::ifstream jsonStream;
+    jsonStream.open(filename.c_str());
+    Json::Value jsonConfig, jsonValue;
+    Json::Reader jsonReader;
+    if (!jsonReader.parse(jsonStream, jsonConfig)) {
+        CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: failed to parse configuration file \""
+                                 << filename << "\"" << std::endl
+                                 << jsonReader.getFormattedErrorMessages();
+        return false;
+    }
+
+    // files are searched relative to the configuration file, then current directory
+    cmnPath configPath;
+    const size_t lastSeparator = filename.find_last_of("/\\");
+    if (lastSeparator != std::string::npos) {
+        configPath.Add(filename.substr(0, lastSeparator));
+    }
+    configPath.Add(cmnPath::GetWorkingDirectory());
+
+    jsonValue = jsonConfig["ip"];
+    if (!jsonValue.empty()) {
+        SetIPAddress(jsonValue.asString());
+    }
+
+    // protocol, "rdt" for Net F/T box, "custom" or "custom-versioned" for custom UDP port
+    std::string protocol = "rdt";
+    jsonValue = jsonConfig["protocol"];
+    if (!jsonValue.empty()) {
+        protocol = jsonValue.asString();
+    }
+    int port = 0;
+    jsonValue = jsonConfig["port"];
+    if (!jsonValue.empty()) {
+        port = jsonValue.asInt();
+    }
+    if (!mtsATINetFTReceiver::ProtocolFromString(protocol, ReceiveProtocol)) {
+        CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: invalid \"protocol\" \"" << protocol
+                                 << "\", must be \"rdt\", \"custom\" or \"custom-versioned\" in "
+                                 << filename << std::endl;
+        return false;
+    }
+    if (ReceiveProtocol == mtsATINetFTReceiver::RDT) {
+        UseCustomPort = false;
+        Data->Port = (port != 0) ? port : ATI_PORT;
     } else {
-        *(uint16*)&(Data->Request)[0] = htons(0x1234); /* standard header. */
-        *(uint16*)&(Data->Request)[2] = htons(ATI_COMMAND); /* per table 9.1 in Net F/T user manual. */
-        *(uint32*)&(Data->Request)[4] = htonl(ATI_NUM_SAMPLES); /* see section 9.1 in Net F/T user manual. */
+        UseCustomPort = true;
+        Data->Port = port;
+    }
+
+    const Json::Value jsonTransport = jsonConfig["transport"];
+    if (!jsonTransport.empty()) {
+        const std::string type = jsonTransport.get("type", "socket").asString();
+        std::string source = jsonTransport.get("name", "").asString();
+        if (type == "replay") {
+            source = configPath.Find(jsonTransport.get("file", "").asString());
+            if (source.empty()) {
+                CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: can't find replay \"file\" \""
+                                         << jsonTransport.get("file", "").asString() << "\" in "
+                                         << configPath << std::endl;
+                return false;
+            }
+        }
+        if (!SetTransport(type, source,
+                          jsonTransport.get("loop", false).asBool(),
+                          jsonTransport.get("speed", 1.0).asDouble())) {
+            return false;
+        }
+    }
+    if (UseCustomPort && (TransportType == "socket") && (Data->Port == 0)) {
+        CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: \"port\" must be defined for protocol \""
+                                 << protocol << "\" in " << filename << std::endl;
+        return false;
+    }
+
+    jsonValue = jsonConfig["socket-timeout"];
+    if (!jsonValue.empty()) {
+        SocketTimeout = jsonValue.asDouble();
+    }
+
+    jsonValue = jsonConfig["receive-buffer-size"];
+    if (!jsonValue.empty()) {
+        SetReceiveBufferSize(jsonValue.asInt());
+    }
+
+    jsonValue = jsonConfig["history-depth"];
+    if (!jsonValue.empty()) {
+        SetHistoryDepth(jsonValue.asUInt());
+    }
+
+    jsonValue = jsonConfig["filter"];
+    if (!jsonValue.empty()) {
+        if (!FilterFromString(jsonValue.asString(), CurrentFilter)) {
+            CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: unknown \"filter\" \"" << jsonValue.asString()
+                                     << "\", must be \"NoFilter\", use \"channels\" for low pass filters in "
+                                     << filename << std::endl;
+            return false;
+        }
+    }
+
+    jsonValue = jsonConfig["calibration-file"];
+    if (!jsonValue.empty()) {
+        const std::string calibrationFile = configPath.Find(jsonValue.asString());
+        if (calibrationFile.empty()) {
+            CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: can't find calibration file \""
+                                     << jsonValue.asString() << "\" in " << configPath << std::endl;
+            return false;
+        }
+        if (LoadCalibration(calibrationFile)) {
+            CMN_LOG_CLASS_INIT_VERBOSE << "ConfigureJSON: calibration file loaded - "
+                                       << calibrationFile << std::endl;
+        }
+    }
+
+    jsonValue = jsonConfig["raw-gauges"];
+    if (!jsonValue.empty()) {
+        SetRawGauges(jsonValue.asBool());
+    }
+
+    jsonValue = jsonConfig["gauge-offsets"];
+    if (!jsonValue.empty()) {
+        if (jsonValue.size() != 6) {
+            CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: \"gauge-offsets\" must have 6 elements in "
+                                     << filename << std::endl;
+            return false;
+        }
+        vctDouble6 offsets;
+        for (Json::ArrayIndex index = 0; index < 6; ++index) {
+            offsets[index] = jsonValue[index].asDouble();
+        }
+        SetGaugeOffsets(offsets);
+    }
+
+    const Json::Value jsonChannels = jsonConfig["channels"];
+    for (Json::ArrayIndex index = 0; index < jsonChannels.size(); ++index) {
+        const Json::Value jsonChannel = jsonChannels[index];
+        if (jsonChannel["name"].empty() || jsonChannel["decimation"].empty()) {
+            CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: \"name\" and \"decimation\" are required for each channel in "
+                                     << filename << std::endl;
+            return false;
+        }
+        if (!AddOutputChannel(jsonChannel["name"].asString(),
+                              jsonChannel["decimation"].asUInt(),
+                              jsonChannel.get("cutoff-ratio", 0.5).asDouble(),
+                              jsonChannel.get("history-depth", 256).asUInt())) {
+            return false;
+        }
+    }
+
+    const Json::Value jsonStatistics = jsonConfig["statistics"];
+    for (Json::ArrayIndex index = 0; index < jsonStatistics.size(); ++index) {
+        const Json::Value jsonWindow = jsonStatistics[index];
+        if (jsonWindow["window"].empty()) {
+            CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: \"window\" is required for each statistics window in "
+                                     << filename << std::endl;
+            return false;
+        }
+        if (!AddStatisticsWindow(jsonWindow.get("name", "").asString(),
+                                 jsonWindow["window"].asUInt())) {
+            return false;
+        }
+    }
+
+    // pose of the tool in the sensor frame, translation and 3x3 rotation matrix
+    const Json::Value jsonTool = jsonConfig["tool-transform"];
+    if (!jsonTool.empty()) {
+        const Json::Value jsonTranslation = jsonTool["translation"];
+        const Json::Value jsonRotation = jsonTool["rotation"];
+        if ((jsonTranslation.size() != 3) || (jsonRotation.size() != 3)) {
+            CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: \"tool-transform\" requires \"translation\" (3 elements) and \"rotation\" (3x3) in "
+                                     << filename << std::endl;
+            return false;
+        }
+        vctFrm3 sensorToTool;
+        vctDouble3x3 rotation;
+        for (Json::ArrayIndex row = 0; row < 3; ++row) {
+            sensorToTool.Translation()[row] = jsonTranslation[row].asDouble();
+            if (jsonRotation[row].size() != 3) {
+                CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: \"tool-transform\" \"rotation\" must be 3x3 in "
+                                         << filename << std::endl;
+                return false;
+            }
+            for (Json::ArrayIndex column = 0; column < 3; ++column) {
+                rotation.Element(row, column) = jsonRotation[row][column].asDouble();
+            }
+        }
+        sensorToTool.Rotation().FromNormalized(rotation);
+        SetToolTransform(sensorToTool);
+    }
+
+    const Json::Value jsonContact = jsonConfig["contact"];
+    if (!jsonContact.empty()) {
+        if (!SetContactThresholds(jsonContact.get("on", 0.0).asDouble(),
+                                  jsonContact.get("off", 0.0).asDouble())) {
+            return false;
+        }
+    }
+
+    const Json::Value jsonOverload = jsonConfig["overload"];
+    if (!jsonOverload.empty()) {
+        if (!SetOverloadThresholds(jsonOverload.get("on", 0.0).asDouble(),
+                                   jsonOverload.get("off", 0.0).asDouble())) {
+            return false;
+        }
+    }
+
+    const Json::Value jsonCapture = jsonConfig["capture"];
+    if (!jsonCapture.empty()) {
+        if (!SetCapture(jsonCapture.get("pre-trigger", 0).asUInt(),
+                        jsonCapture.get("post-trigger", 0).asUInt(),
+                        jsonCapture.get("directory", ".").asString(),
+                        jsonCapture.get("prefix", "capture").asString())) {
+            return false;
+        }
+        vctDouble6 axis(0.0), rate(0.0);
+        const Json::Value jsonAxis = jsonCapture["axis-thresholds"];
+        const Json::Value jsonRate = jsonCapture["rate-thresholds"];
+        if ((!jsonAxis.empty() && (jsonAxis.size() != 6))
+            || (!jsonRate.empty() && (jsonRate.size() != 6))) {
+            CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: capture \"axis-thresholds\" and \"rate-thresholds\" must have 6 elements in "
+                                     << filename << std::endl;
+            return false;
+        }
+        for (Json::ArrayIndex index = 0; index < jsonAxis.size(); ++index) {
+            axis[index] = jsonAxis[index].asDouble();
+        }
+        for (Json::ArrayIndex index = 0; index < jsonRate.size(); ++index) {
+            rate[index] = jsonRate[index].asDouble();
+        }
+        SetCaptureThresholds(axis,
+                             jsonCapture.get("force-threshold", 0.0).asDouble(),
+                             jsonCapture.get("torque-threshold", 0.0).asDouble(),
+                             rate);
+    }
+
+    const Json::Value jsonMulticast = jsonConfig["multicast"];
+    if (!jsonMulticast.empty()) {
+        SetMulticast(jsonMulticast.get("group", "239.255.0.1").asString(),
+                     jsonMulticast.get("port", 49153).asInt(),
+                     jsonMulticast.get("samples-per-datagram", 7).asUInt(),
+                     jsonMulticast.get("ttl", 1).asInt(),
+                     jsonMulticast.get("interface", "").asString());
+    }
+
+    const Json::Value jsonSharedMemory = jsonConfig["shared-memory"];
+    if (!jsonSharedMemory.empty()) {
+        SetSharedMemory(jsonSharedMemory.get("name", "atinetft").asString(),
+                        jsonSharedMemory.get("capacity", 1024).asUInt());
+    }
+
+    // "osaSocket" (default), "io_uring" (Linux only) or "busy-poll"
+    jsonValue = jsonConfig["receive-backend"];
+    if (!jsonValue.empty()) {
+        SetReceiveBackend(jsonValue.asString());
+    }
+
+    const Json::Value jsonBusyPoll = jsonConfig["busy-poll"];
+    if (!jsonBusyPoll.empty()) {
+        SetBusyPoll(jsonBusyPoll.get("spin-time", 1.0).asDouble(),
+                    jsonBusyPoll.get("yield-time", 0.0).asDouble(),
+                    jsonBusyPoll.get("so-busy-poll", 50).asInt());
+    }
 
-        Socket.SetDestination(IP, Data->Port);
+    // number of events kept per thread, 0 to disable
+    const Json::Value jsonTracing = jsonConfig["tracing"];
+    if (!jsonTracing.empty()) {
+        if (!SetTracing(jsonTracing.get("capacity", 65536).asUInt())) {
+            return false;
+        }
+    }
+
+    const Json::Value jsonReceiveThread = jsonConfig["receive-thread"];
+    if (!jsonReceiveThread.empty()) {
+        SetReceiveThread(jsonReceiveThread.get("enabled", true).asBool(),
+                         jsonReceiveThread.get("cpu", -1).asInt(),
+                         jsonReceiveThread.get("priority", 0).asInt(),
+                         jsonReceiveThread.get("queue-size", 1024).asUInt());
+    }
+
+    const Json::Value jsonClockModel = jsonConfig["clock-model"];
+    if (!jsonClockModel.empty()) {
+        SetClockModel(jsonClockModel.get("enabled", true).asBool(),
+                      jsonClockModel.get("time-constant", 10.0).asDouble(),
+                      jsonClockModel.get("latency", 0.0).asDouble());
+    }
+
+    // "continuous" (default) or "on-demand"
+    jsonValue = jsonConfig["acquisition-mode"];
+    if (!jsonValue.empty()) {
+        SetAcquisitionMode(jsonValue.asString());
+    }
+
+    // number of missed intervals, 0 to disable
+    jsonValue = jsonConfig["stall-watchdog"];
+    if (!jsonValue.empty()) {
+        SetStallWatchdog(jsonValue.asDouble());
+    }
+
+    const Json::Value jsonThread = jsonConfig["thread"];
+    if (!jsonThread.empty()) {
+        SetCPUAffinity(jsonThread.get("cpu", -1).asInt());
+        SetRealTimePriority(jsonThread.get("priority", 0).asInt());
+        SetLockMemory(jsonThread.get("lock-memory", false).asBool(),
+                      jsonThread.get("prefault-stack-size", 512 * 1024).asUInt());
     }
+    return true;
+#else
+    CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: cisst was compiled without JSON support, can't load "
+                             << filename << std::endl;
+    return false;
+#endif
 }
 
 void mtsATINetFTSensor::Configure(const std::string & filename,
                                   double timeout,
                                   int customPortNumber)
 {
+    ConfigurationFailed = false;
     UseCustomPort = false;
+    ReceiveProtocol = mtsATINetFTReceiver::RDT;
     SocketTimeout = timeout;
     if(customPortNumber) {
         UseCustomPort = true;
+        ReceiveProtocol = mtsATINetFTReceiver::CUSTOM;
         Data->Port = customPortNumber;
     }
 
+    // JSON configuration file overrides timeout and port
+    const std::string extension = ".json";
+    if ((filename.size() > extension.size())
+        && (filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0)) {
+        ConfigurationFailed = !ConfigureJSON(filename);
+        if (ConfigurationFailed) {
+            CMN_LOG_CLASS_INIT_ERROR << "Configure: failed to configure from " << filename
+                                     << ", sensor will not start" << std::endl;
+            EventTriggers.ErrorMsg(std::string("Configure: failed to configure from ") + filename);
+        }
+        return;
+    }
+
     if(!filename.empty()) {
         // Currently, this requires XML support (cisstCommonXML), but will return false
         // if XML is not enabled.
-        if (NetFTConfig.LoadCalibrationFile(filename)) {
-            IsCalibFileLoaded = true;
+        if (LoadCalibration(filename)) {
             CMN_LOG_CLASS_RUN_WARNING << "Configure: file loaded - "
                                       << filename << std::endl;
             CMN_LOG_CLASS_RUN_VERBOSE << "Force Ranges: " <<  NetFTConfig.GenInfo.MaxRatings << std::endl;
@@ -127,19 +698,65 @@ void mtsATINetFTSensor::Configure(const std::string & filename,
 
 void mtsATINetFTSensor::Cleanup(void)
 {
-    if(!UseCustomPort) {
-        *(uint16*)&(Data->Request)[0] = htons(0x1234);
-        *(uint16*)&(Data->Request)[2] = htons(0); /* Stop streaming */
-        *(uint32*)&(Data->Request)[4] = htonl(ATI_NUM_SAMPLES);
-
-        // try to send, but timeout after 10 ms
-        int result = Socket.Send((const char *)(Data->Request), 8, 10.0 * cmn_ms);
-        if (result == -1) {
-            CMN_LOG_CLASS_RUN_WARNING << "Cleanup: UDP send failed" << std::endl;
-            return;
+    if (ConfigurationFailed) {
+        return;
+    }
+    if (ReceiveThread) {
+        ReceiveThread->Stop();
+        CMN_LOG_CLASS_INIT_VERBOSE << "Cleanup: receive thread got "
+                                   << ReceiveThread->GetNumberOfPackets() << " packets, dropped "
+                                   << ReceiveThread->GetNumberOfDropped() << " (queue full)" << std::endl;
+    }
+#if (CISST_OS != CISST_WINDOWS)
+    if (BusyPollTransport) {
+        mtsATINetFTTransportBusyPoll::Times times;
+        BusyPollTransport->GetTimes(times);
+        const double total = times.Spinning + times.Yielding + times.Productive;
+        CMN_LOG_CLASS_INIT_VERBOSE << "Cleanup: busy-poll " << times.Packets << " packets, spinning "
+                                   << times.Spinning << " s, yielding " << times.Yielding
+                                   << " s, productive " << times.Productive << " s ("
+                                   << ((total > 0.0) ? 100.0 * times.Productive / total : 0.0)
+                                   << "% of polling time)" << std::endl;
+    }
+#endif
+    CMN_LOG_CLASS_INIT_VERBOSE << "Cleanup: " << NumberOfStalls.load() << " stall(s), "
+                               << NumberOfDisconnects.load() << " disconnect(s)" << std::endl;
+    if (ClockModel.IsLocked()) {
+        CMN_LOG_CLASS_INIT_VERBOSE << "Cleanup: sensor clock period " << ClockModel.GetPeriod()
+                                   << " s, jitter removed " << ClockModel.GetJitter() << " s RMS, "
+                                   << ClockModel.GetNumberOfResets() << " resets, "
+                                   << ClockModel.GetNumberOfLatePackets() << " late packets" << std::endl;
+    }
+    if (Receiver) {
+        if (Receiver->GetNumberOfInvalidPackets() > 0) {
+            CMN_LOG_CLASS_INIT_WARNING << "Cleanup: ignored " << Receiver->GetNumberOfInvalidPackets()
+                                       << " packets not matching protocol \"" << Receiver->GetProtocolName()
+                                       << "\"" << std::endl;
         }
     }
-    Socket.Close();
+    if (NumberOfSourceSwitches > 0) {
+        CMN_LOG_CLASS_INIT_VERBOSE << "Cleanup: " << NumberOfSourceSwitches.load() << " source switch(es), "
+                                   << NumberOfFailedSwitches.load() << " failed, longest interruption "
+                                   << LongestInterruption.load() << " s" << std::endl;
+    }
+    CloseSource(Socket, Receiver, SendCommands);
+#if (CISST_OS != CISST_WINDOWS)
+    if (SharedMemory) {
+        SharedMemory->Close();
+    }
+    if (Multicast) {
+        Multicast->Close();
+        CMN_LOG_CLASS_INIT_VERBOSE << "Cleanup: multicast sent " << Multicast->GetNumberOfDatagrams()
+                                   << " datagrams, " << Multicast->GetNumberOfSendErrors()
+                                   << " send errors" << std::endl;
+    }
+#endif
+    if (Capture) {
+        Capture->Stop();
+    }
+    if (Trace) {
+        Trace->Stop();
+    }
 }
 
 void mtsATINetFTSensor::SetIPAddress(const std::string & ip)
@@ -147,176 +764,1598 @@ void mtsATINetFTSensor::SetIPAddress(const std::string & ip)
     IP = ip;
 }
 
-void mtsATINetFTSensor::Run(void)
+void mtsATINetFTSensor::SetReceiveBufferSize(const int bytes)
 {
-    if(!IsConnected) {
-        // Start streaming
-        *(uint16*)&(Data->Request)[2] = htons(ATI_COMMAND);
-        int result = Socket.Send((const char *)(Data->Request), 8, SocketTimeout);
-        if (result == -1) {
-            IsConnected = false;
-            FTRawData.SetValid(false);
-            ForceTorque.SetValid(false);
-            CMN_LOG_CLASS_RUN_WARNING << "GetReadings: UDP send failed" << std::endl;
-            return;
-        } else {
-            IsConnected = true;
-        }
-    }
-
-    ProcessQueuedCommands();
-    if(UseCustomPort) {
-        GetReadingsFromCustomPort();
-    } else {
-        GetReadings();
-    }
+    ReceiveBufferSize = bytes;
+}
 
-    if (IsSaturated || HasError) {
-        CMN_LOG_CLASS_RUN_WARNING << "Run: sensor saturated or has error" << std::endl;
-        FTRawData.SetValid(false);
-    }
+void mtsATINetFTSensor::SetRawGauges(const bool rawGauges)
+{
+    UseRawGauges = rawGauges;
+}
 
-    // Bias the FT data based on bias vec
-    ForceTorque.Valid() = FTRawData.Valid();
-    ForceTorque.SetForce(FTRawData);
+void mtsATINetFTSensor::SetGaugeOffsets(const vctDouble6 & offsets)
+{
+    GaugeOffsets.Assign(offsets);
+    HasGaugeOffsets = true;
+}
 
-    // Update PercentOfMax, 0 if there is an error or is saturated
-    /// \note what about isConnected?
-    if (IsSaturated || HasError) {
-        PercentOfMaxVec.SetAll(100.0);
-    } else if(IsCalibFileLoaded) {
-        PercentOfMaxVec = (FTRawData.Abs().ElementwiseDivide(vctDoubleVec(NetFTConfig.GenInfo.MaxRatings))) * 100.0;
+void mtsATINetFTSensor::ConfigureGaugeCalibration(void)
+{
+    if (!UseRawGauges) {
+        return;
     }
-
+    if (ReceiveProtocol == mtsATINetFTReceiver::RDT) {
+        CMN_LOG_CLASS_INIT_ERROR << "ConfigureGaugeCalibration: raw gauges are only supported with the custom protocols, the Net F/T box sends calibrated data" << std::endl;
+        UseRawGauges = false;
+        return;
+    }
+    if (!IsCalibFileLoaded || !GaugeCalibration.Set(NetFTConfig)) {
+        CMN_LOG_CLASS_INIT_ERROR << "ConfigureGaugeCalibration: raw gauges require a valid calibration file" << std::endl;
+        UseRawGauges = false;
+        return;
+    }
+    if (HasGaugeOffsets) {
+        GaugeCalibration.SetOffsets(GaugeOffsets.Pointer());
+    }
+    CMN_LOG_CLASS_INIT_VERBOSE << "ConfigureGaugeCalibration: using calibration matrix from "
+                               << NetFTConfig.CalibInfo.SerialNumber << ", gauge offsets "
+                               << vctDouble6(GaugeCalibration.GetOffsets()[0], GaugeCalibration.GetOffsets()[1],
+                                             GaugeCalibration.GetOffsets()[2], GaugeCalibration.GetOffsets()[3],
+                                             GaugeCalibration.GetOffsets()[4], GaugeCalibration.GetOffsets()[5])
+                               << std::endl;
 }
 
-void mtsATINetFTSensor::GetReadings(void)
+void mtsATINetFTSensor::SetHistoryDepth(const size_t depth)
 {
-    int result;
+    if (!StateTable.SetSize(depth)) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetHistoryDepth: failed to resize state table to "
+                                 << depth << std::endl;
+    }
+}
 
-    // if we were able to send we should now receive
-    result = Socket.Receive((char *)(Data->Response), 36, SocketTimeout);
-    if (result > 0) {
-        this->Data->RdtSequence = ntohl(*(uint32*)&(Data->Response)[0]);
-        this->Data->FtSequence = ntohl(*(uint32*)&(Data->Response)[4]);
-        this->Data->Status = ntohl(*(uint32*)&(Data->Response)[8]);
+bool mtsATINetFTSensor::AddOutputChannel(const std::string & name,
+                                         const unsigned int decimation,
+                                         const double cutoffRatio,
+                                         const size_t historyDepth)
+{
+    if (decimation == 0) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddOutputChannel: decimation must be at least 1 for channel \""
+                                 << name << "\"" << std::endl;
+        return false;
+    }
+    mtsInterfaceProvided * interfaceProvided = AddInterfaceProvided(name);
+    if (!interfaceProvided) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddOutputChannel: failed to add interface for channel \""
+                                 << name << "\", name already used?" << std::endl;
+        return false;
+    }
+    mtsATINetFTOutputChannel * channel
+        = new mtsATINetFTOutputChannel(name, decimation, cutoffRatio, historyDepth);
+    AddStateTable(channel->StateTable);
+    interfaceProvided->AddCommandReadState(*(channel->StateTable), channel->ForceTorque, "measured_cf");
+    interfaceProvided->AddCommandReadState(*(channel->StateTable), channel->StateTable->PeriodStats,
+                                           "GetPeriodStatistics");
+    OutputChannels.push_back(channel);
+    CMN_LOG_CLASS_INIT_VERBOSE << "AddOutputChannel: added channel \"" << name
+                               << "\" with decimation " << decimation << std::endl;
+    return true;
+}
 
-        CheckSaturation(this->Data->Status);
-        CheckForErrors(this->Data->Status);
+bool mtsATINetFTSensor::SetOutputChannelFilter(const std::string & name,
+                                               const unsigned int decimation,
+                                               const double cutoffRatio)
+{
+    mtsATINetFTOutputChannel * channel = GetOutputChannel(name);
+    if (!channel) {
+        CMN_LOG_CLASS_RUN_ERROR << "SetOutputChannelFilter: no channel \"" << name << "\"" << std::endl;
+        return false;
+    }
+    if (!channel->SetFilter(decimation, cutoffRatio)) {
+        CMN_LOG_CLASS_RUN_ERROR << "SetOutputChannelFilter: invalid decimation " << decimation
+                                << " or cutoff ratio " << cutoffRatio << " for channel \""
+                                << name << "\"" << std::endl;
+        return false;
+    }
+    CMN_LOG_CLASS_RUN_VERBOSE << "SetOutputChannelFilter: channel \"" << name
+                              << "\" decimation " << decimation << ", cutoff ratio "
+                              << cutoffRatio << std::endl;
+    return true;
+}
 
-        int temp;
-        for (int i = 0; i < 6; i++ ) {
-            temp = ntohl(*(int32*)&(Data->Response)[12 + i * 4]);
-            FTRawData[i]= (double)((double)temp/1000000);
+mtsATINetFTOutputChannel * mtsATINetFTSensor::GetOutputChannel(const std::string & name) const
+{
+    for (size_t i = 0; i < OutputChannels.size(); ++i) {
+        if (OutputChannels[i]->GetName() == name) {
+            return OutputChannels[i];
         }
-        FTRawData.SetValid(true);
     }
-    else {
-        IsConnected = false;
-        FTRawData.SetValid(false);
-        // If there are packets missing then the state table will not be updated;
-        // when queried previous FT will be returned;
-        // If you want FT to be zero, when a packet is missed, uncomment the below line
+    return 0;
+}
 
-        // FTRawData.Zeros();
+bool mtsATINetFTSensor::AddStatisticsWindow(const std::string & name,
+                                            const size_t windowSize)
+{
+    if (windowSize < 2) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddStatisticsWindow: window size must be at least 2 for \""
+                                 << name << "\"" << std::endl;
+        return false;
+    }
+    mtsInterfaceProvided * interfaceProvided = GetInterfaceProvided("ProvidesATINetFTSensor");
+    if (!interfaceProvided) {
+        return false;
     }
+    // statistics are computed by the reader from the sums, no state table needed
+    mtsATINetFTStatistics * window = new mtsATINetFTStatistics(name, windowSize);
+    mtsDoubleMat prototype;
+    prototype.SetSize(mtsATINetFTStatistics::NUMBER_OF_ROWS, 6);
+    if (!interfaceProvided->AddCommandRead(&mtsATINetFTStatistics::GetStatistics, window,
+                                           "GetStatistics" + name, prototype)) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddStatisticsWindow: failed to add command for \""
+                                 << name << "\", name already used?" << std::endl;
+        delete window;
+        return false;
+    }
+    StatisticsWindows.push_back(window);
+    return true;
 }
 
-void mtsATINetFTSensor::GetReadingsFromCustomPort()
+void mtsATINetFTSensor::SetToolTransform(const vctFrm3 & sensorToTool)
 {
-    // read force sensor data sending over a udp port
-    // read UDP packets
-    int bytesRead;
-    char buffer[512];
-    double *packetReceived;
-
-    bytesRead = Socket.Receive(buffer, 56, SocketTimeout);
-    if (bytesRead  > 0) {
-        IsConnected = true;
-        if (bytesRead == (6 * sizeof(double) + 2 * sizeof(int))) {
-            packetReceived = reinterpret_cast<double *>(buffer);
-            // Force-Torque values
-            for (int i = 0; i < 6; i++ ) {
-                FTRawData[i] = packetReceived[i];
-            }
-
-            FTRawData.SetValid(true);
-
-            // Error bits
-            int error = (int)buffer[48];
-            int saturated = (int)buffer[52];
-
-            if( error == 1)
-                HasError = true;
-            else
-                HasError = false;
+    ToolTransform.Set(sensorToTool);
+}
 
-            if( saturated == 1)
-                IsSaturated = true;
-            else
-                IsSaturated = false;
+bool mtsATINetFTSensor::SetContactThresholds(const double on, const double off)
+{
+    if (!ContactDetector.SetThresholds(on, off)) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetContactThresholds: off (" << off
+                                 << ") must be lower than on (" << on << ")" << std::endl;
+        return false;
+    }
+    return true;
+}
 
-        } else {
-            std::cerr << "!" << std::flush;
-        }
-    } else {
-        CMN_LOG_CLASS_RUN_WARNING << "GetReadings: UDP receive from xPC failed" << std::endl;
-        FTRawData.SetValid(false);
-        IsConnected = false;
-        // FTRawData.Zeros();
+bool mtsATINetFTSensor::SetOverloadThresholds(const double onPercent, const double offPercent)
+{
+    if (!OverloadDetector.SetThresholds(onPercent, offPercent)) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetOverloadThresholds: off (" << offPercent
+                                 << ") must be lower than on (" << onPercent << ")" << std::endl;
+        return false;
     }
+    return true;
 }
 
-void mtsATINetFTSensor::ApplyFilter(const mtsDoubleVec & rawFT, mtsDoubleVec & filteredFT, const FilterType &filter)
+bool mtsATINetFTSensor::SetCapture(const size_t preTrigger, const size_t postTrigger,
+                                   const std::string & directory, const std::string & prefix)
 {
-    if(rawFT.size() != 6) {
-        CMN_LOG_CLASS_RUN_ERROR << "ApplyFilter: Size mismatch" << std::endl;
-        return;
+    if (!Capture) {
+        Capture = new mtsATINetFTCapture;
+    }
+    if (!Capture->Configure(preTrigger, postTrigger, directory, prefix)) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetCapture: failed to configure capture" << std::endl;
+        return false;
     }
+    CMN_LOG_CLASS_INIT_VERBOSE << "SetCapture: " << preTrigger << " samples before and "
+                               << postTrigger << " samples after trigger, saved in "
+                               << directory << std::endl;
+    return true;
+}
 
-    if(filter == NO_FILTER) {
-        filteredFT = rawFT;
+bool mtsATINetFTSensor::SetTracing(const size_t capacity)
+{
+    if (capacity == 0) {
+        delete Trace;
+        Trace = 0;
+        return true;
+    }
+    if (!Trace) {
+        Trace = new mtsATINetFTTrace;
+    }
+    if (!Trace->Configure(capacity, 2)) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetTracing: failed to configure trace" << std::endl;
+        return false;
     }
+    CMN_LOG_CLASS_INIT_VERBOSE << "SetTracing: keeping the latest " << capacity
+                               << " events per thread" << std::endl;
+    return true;
 }
 
-void mtsATINetFTSensor::SetFilter(const std::string &filterName)
+void mtsATINetFTSensor::SaveTrace(const std::string & filename)
 {
-    if(filterName == "NoFilter") {
-        CurrentFilter = NO_FILTER;
+    if (!Trace) {
+        CMN_LOG_CLASS_RUN_WARNING << "SaveTrace: tracing is not enabled, see SetTracing" << std::endl;
+        return;
+    }
+    // the writer thread copies the rings and names the file if needed
+    if (!Trace->Save(filename, GetName())) {
+        CMN_LOG_CLASS_RUN_WARNING << "SaveTrace: previous trace is not saved yet" << std::endl;
+        EventTriggers.ErrorMsg(std::string("SaveTrace: previous trace is not saved yet"));
+        return;
     }
+    CMN_LOG_CLASS_RUN_VERBOSE << "SaveTrace: requested trace " << filename << std::endl;
 }
 
-void mtsATINetFTSensor::Rebias(void)
+void mtsATINetFTSensor::SetCaptureThresholds(const vctDouble6 & axis, const double force, const double torque,
+                                             const vctDouble6 & rate)
 {
-    if(UseCustomPort)
+    if (!Capture) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetCaptureThresholds: SetCapture must be called first" << std::endl;
         return;
+    }
+    Capture->SetAxisThresholds(axis.Pointer());
+    Capture->SetForceThreshold(force);
+    Capture->SetTorqueThreshold(torque);
+    Capture->SetRateThresholds(rate.Pointer());
+}
 
-    *(uint16*)&(Data->Request)[2] = htons(0x0042);
-    int result = Socket.Send((const char *)(Data->Request), 8, SocketTimeout);
-    if (result == -1) {
-        IsConnected = false;
-        CMN_LOG_CLASS_RUN_WARNING << "Rebias: UDP send failed" << std::endl;
+void mtsATINetFTSensor::TriggerCapture(void)
+{
+    if (!Capture) {
+        CMN_LOG_CLASS_RUN_WARNING << "TriggerCapture: capture is not configured" << std::endl;
         return;
     }
+    Capture->Trigger();
+}
 
-    EventTriggers.ErrorMsg(std::string("Sensor ReBiased"));
-    CMN_LOG_CLASS_RUN_VERBOSE << "FT Sensor Rebiased " << std::endl;
+void mtsATINetFTSensor::SetCPUAffinity(const int cpu)
+{
+    ThreadCPU = cpu;
 }
 
-void mtsATINetFTSensor::CheckSaturation(const unsigned int status)
+void mtsATINetFTSensor::SetRealTimePriority(const int priority)
 {
-    if(status == ntohl(0x00020000))
-        IsSaturated = true;
-    else
-        IsSaturated = false;
+    ThreadPriority = priority;
 }
 
-void mtsATINetFTSensor::CheckForErrors(const unsigned int status)
+void mtsATINetFTSensor::SetLockMemory(const bool lock, const size_t stackSize)
 {
-    // Check for errors
-    if( (status == ntohl(0x00000000)) || (status == ntohl(0x80010000)) )
-        HasError = false;
-    else
-        HasError = true;
+    ThreadLockMemory = lock;
+    ThreadPrefaultStackSize = lock ? stackSize : 0;
+}
+
+void mtsATINetFTSensor::ConfigureThread(void)
+{
+    mtsATINetFTConfigureCurrentThread(this->GetName(), ThreadCPU, ThreadPriority,
+                                      ThreadLockMemory, ThreadPrefaultStackSize);
+}
 
+void mtsATINetFTSensor::SetReceiveBackend(const std::string & backend)
+{
+    ReceiveBackend = backend;
+}
+
+template <class _protocol, class _transport, class... _arguments>
+mtsATINetFTReceiver * mtsATINetFTSensor::NewSource(_transport * & transport, _arguments & ... arguments)
+{
+    typedef mtsATINetFTSource<_transport, _protocol> SourceType;
+    SourceType * source = new SourceType(arguments...);
+    transport = &(source->GetTransport());
+    ReceiverMethods.Counts = &mtsATINetFTSensor::ReceiveFromSource<SourceType, false>;
+    ReceiverMethods.RawGauges = &mtsATINetFTSensor::ReceiveFromSource<SourceType, true>;
+    ReceiverMethods.StartThread = &mtsATINetFTSensor::StartSourceThread<SourceType>;
+    return source;
+}
+
+// one source type per transport and protocol, the only runtime choice
+// is made here when the source is opened
+template <class _transport, class... _arguments>
+mtsATINetFTReceiver * mtsATINetFTSensor::CreateSource(const mtsATINetFTReceiver::Protocol protocol,
+                                                      _transport * & transport, _arguments & ... arguments)
+{
+    switch (protocol) {
+    case mtsATINetFTReceiver::CUSTOM:
+        return NewSource<mtsATINetFTProtocolCustom>(transport, arguments...);
+    case mtsATINetFTReceiver::CUSTOM_VERSIONED:
+        return NewSource<mtsATINetFTProtocolCustomVersioned>(transport, arguments...);
+    default:
+        return NewSource<mtsATINetFTProtocolRDT>(transport, arguments...);
+    }
+}
+
+bool mtsATINetFTSensor::ConfigureReceiver(void)
+{
+    if (Receiver) {
+        return true;
+    }
+    std::string errorMessage;
+    bool isOpen = false;
+    if (TransportType == "replay") {
+        mtsATINetFTTransportReplay * replay;
+        Receiver = CreateSource(ReceiveProtocol, replay);
+        replay->SetFile(TransportSource, TransportLoop, TransportSpeed);
+    } else if (TransportType == "shared-memory") {
+#if (CISST_OS != CISST_WINDOWS)
+        mtsATINetFTTransportSharedMemory * sharedMemory;
+        Receiver = CreateSource(ReceiveProtocol, sharedMemory);
+        sharedMemory->SetName(TransportSource);
+#else
+        CMN_LOG_CLASS_INIT_ERROR << "ConfigureReceiver: shared memory transport is not supported on this platform"
+                                 << std::endl;
+#endif
+    } else if (TransportType == "injection") {
+        if (!InjectionQueue.load(std::memory_order_relaxed)) {
+            InjectionQueue.store(new mtsATINetFTInjectionQueue, std::memory_order_release);
+        }
+        mtsATINetFTTransportInjection * injection;
+        Receiver = CreateSource(ReceiveProtocol, injection, *InjectionQueue.load(std::memory_order_relaxed));
+    } else if (ReceiveBackend == "io_uring") {
+#if sawATIForceSensor_HAS_IO_URING
+        mtsATINetFTTransportIOUring * ioUring;
+        Receiver = CreateSource(ReceiveProtocol, ioUring, *Socket);
+        isOpen = Receiver->Open(errorMessage);
+        if (!isOpen) {
+            CMN_LOG_CLASS_INIT_WARNING << "ConfigureReceiver: io_uring backend not available, "
+                                       << errorMessage << ", using osaSocket" << std::endl;
+            delete Receiver;
+            Receiver = 0;
+        }
+#else
+        CMN_LOG_CLASS_INIT_WARNING << "ConfigureReceiver: compiled without io_uring backend, using osaSocket"
+                                   << std::endl;
+#endif
+    } else if (ReceiveBackend == "busy-poll") {
+#if (CISST_OS != CISST_WINDOWS)
+        Receiver = CreateSource(ReceiveProtocol, BusyPollTransport, *Socket,
+                                BusyPollSpinTime, BusyPollYieldTime, BusyPollSocket);
+        // spinning only makes sense on a dedicated core
+        const int cpu = UseReceiveThread ? ReceiveThreadCPU : ThreadCPU;
+        if (cpu < 0) {
+            CMN_LOG_CLASS_INIT_WARNING << "ConfigureReceiver: busy-poll receive backend without CPU affinity, "
+                                       << "the receiving thread will use a full core shared with other threads"
+                                       << std::endl;
+        }
+#else
+        CMN_LOG_CLASS_INIT_WARNING << "ConfigureReceiver: busy-poll backend is not supported on this platform, using osaSocket"
+                                   << std::endl;
+#endif
+    } else if (ReceiveBackend != "osaSocket") {
+        CMN_LOG_CLASS_INIT_WARNING << "ConfigureReceiver: unknown receive backend \"" << ReceiveBackend
+                                   << "\", using osaSocket" << std::endl;
+    }
+    if (!Receiver) {
+        mtsATINetFTTransportSocket * socket;
+        Receiver = CreateSource(ReceiveProtocol, socket, *Socket);
+    }
+    if (!isOpen && !Receiver->Open(errorMessage)) {
+        CMN_LOG_CLASS_INIT_ERROR << "ConfigureReceiver: failed to open " << Receiver->GetName()
+                                 << " transport, " << errorMessage << std::endl;
+        return false;
+    }
+    CMN_LOG_CLASS_INIT_VERBOSE << "ConfigureReceiver: using " << Receiver->GetName()
+                               << " transport with " << Receiver->GetProtocolName()
+                               << " protocol" << std::endl;
+    return true;
+}
+
+bool mtsATINetFTSensor::SetTransport(const std::string & transport, const std::string & source,
+                                     const bool loop, const double speed)
+{
+    if ((transport != "socket") && (transport != "replay")
+        && (transport != "shared-memory") && (transport != "injection")) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetTransport: invalid transport \"" << transport
+                                 << "\", must be \"socket\", \"replay\", \"shared-memory\" or \"injection\""
+                                 << std::endl;
+        return false;
+    }
+    if (((transport == "replay") || (transport == "shared-memory")) && source.empty()) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetTransport: transport \"" << transport
+                                 << "\" requires a file or shared memory name" << std::endl;
+        return false;
+    }
+    TransportType = transport;
+    TransportSource = source;
+    TransportLoop = loop;
+    TransportSpeed = speed;
+    return true;
+}
+
+bool mtsATINetFTSensor::InjectDatagram(const char * buffer, const size_t size)
+{
+    // the queue is never deleted while the component exists
+    mtsATINetFTInjectionQueue * queue = InjectionQueue.load(std::memory_order_acquire);
+    if (!queue || !UseInjection.load(std::memory_order_acquire)) {
+        return false;
+    }
+    return queue->Inject(buffer, size);
+}
+
+void mtsATINetFTSensor::GetSourceSettings(SourceSettings & source) const
+{
+    source.IP = IP;
+    source.Port = Data->Port;
+    source.Protocol = ReceiveProtocol;
+    source.TransportType = TransportType;
+    source.TransportSource = TransportSource;
+    source.TransportLoop = TransportLoop;
+    source.TransportSpeed = TransportSpeed;
+    source.ReceiveBackend = ReceiveBackend;
+}
+
+void mtsATINetFTSensor::SetSourceSettings(const SourceSettings & source)
+{
+    IP = source.IP;
+    Data->Port = source.Port;
+    ReceiveProtocol = source.Protocol;
+    UseCustomPort = (source.Protocol != mtsATINetFTReceiver::RDT);
+    TransportType = source.TransportType;
+    TransportSource = source.TransportSource;
+    TransportLoop = source.TransportLoop;
+    TransportSpeed = source.TransportSpeed;
+    ReceiveBackend = source.ReceiveBackend;
+}
+
+bool mtsATINetFTSensor::OpenSource(void)
+{
+    // replay and shared memory transports deliver versioned custom datagrams
+    const bool useSocket = (TransportType == "socket");
+    if (!useSocket && (TransportType != "injection")
+        && (ReceiveProtocol != mtsATINetFTReceiver::CUSTOM_VERSIONED)) {
+        CMN_LOG_CLASS_INIT_VERBOSE << "OpenSource: using protocol \"custom-versioned\" for transport \""
+                                   << TransportType << "\"" << std::endl;
+        ReceiveProtocol = mtsATINetFTReceiver::CUSTOM_VERSIONED;
+        UseCustomPort = true;
+    }
+    SendCommands = useSocket && (ReceiveProtocol == mtsATINetFTReceiver::RDT);
+
+    if (!useSocket) {
+        // nothing to configure
+    } else if(UseCustomPort) {
+        if (!Socket->AssignPort(Data->Port)) {
+            CMN_LOG_CLASS_INIT_ERROR << "OpenSource: failed to bind port " << Data->Port << std::endl;
+        }
+    } else {
+        *(uint16*)&(Data->Request)[0] = htons(0x1234); /* standard header. */
+        *(uint16*)&(Data->Request)[2] = htons(ATI_COMMAND); /* per table 9.1 in Net F/T user manual. */
+        *(uint32*)&(Data->Request)[4] = htonl(ATI_NUM_SAMPLES); /* see section 9.1 in Net F/T user manual. */
+
+        Socket->SetDestination(IP, Data->Port);
+    }
+
+    if (useSocket && (ReceiveBufferSize > 0)) {
+#if (CISST_OS == CISST_LINUX)
+        int size = ReceiveBufferSize;
+        if (setsockopt(Socket->GetIdentifier(), SOL_SOCKET, SO_RCVBUF, &size, sizeof(size)) != 0) {
+            CMN_LOG_CLASS_INIT_WARNING << "OpenSource: failed to set receive buffer size to "
+                                       << ReceiveBufferSize << std::endl;
+        }
+        socklen_t length = sizeof(size);
+        getsockopt(Socket->GetIdentifier(), SOL_SOCKET, SO_RCVBUF, &size, &length);
+        // Linux doubles the requested size and caps it to net.core.rmem_max
+        CMN_LOG_CLASS_INIT_VERBOSE << "OpenSource: receive buffer size requested "
+                                   << ReceiveBufferSize << ", actual " << size << std::endl;
+#else
+        CMN_LOG_CLASS_INIT_WARNING << "OpenSource: receive buffer size is only supported on Linux" << std::endl;
+#endif
+    }
+
+    const bool isOpen = ConfigureReceiver();
+    UseInjection.store(isOpen && (TransportType == "injection"), std::memory_order_release);
+    UseClockModel = ClockModelEnabled;
+    if (UseClockModel && !Receiver->HasSequence()) {
+        CMN_LOG_CLASS_INIT_VERBOSE << "OpenSource: protocol \"" << Receiver->GetProtocolName()
+                                   << "\" has no sequence numbers, clock model disabled" << std::endl;
+        UseClockModel = false;
+    }
+    return isOpen;
+}
+
+void mtsATINetFTSensor::CloseSource(osaSocket * socket, mtsATINetFTReceiver * receiver,
+                                    const bool sendCommands)
+{
+    if (receiver) {
+        receiver->Close();
+    }
+    if (sendCommands) {
+        *(uint16*)&(Data->Request)[0] = htons(0x1234);
+        *(uint16*)&(Data->Request)[2] = htons(0); /* Stop streaming */
+        *(uint32*)&(Data->Request)[4] = htonl(ATI_NUM_SAMPLES);
+
+        // try to send, but timeout after 10 ms
+        int result = socket->Send((const char *)(Data->Request), 8, 10.0 * cmn_ms);
+        if (result == -1) {
+            CMN_LOG_CLASS_RUN_WARNING << "CloseSource: UDP send failed" << std::endl;
+        }
+    }
+    socket->Close();
+}
+
+bool mtsATINetFTSensor::SwitchSource(const SourceSettings & source)
+{
+    if (!Receiver) {
+        // not started yet, used by Startup
+        SetSourceSettings(source);
+        return true;
+    }
+    const double start = mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime();
+    if (!MeasuringInterruption) {
+        InterruptionStart = IsReceiving ? LastPacketTime : start;
+    }
+
+    // packets already received from the current source are processed first
+    StopReceiveThread();
+
+    // current source, kept open until the new one is ready
+    SourceSettings previous;
+    GetSourceSettings(previous);
+    osaSocket * previousSocket = Socket;
+    mtsATINetFTReceiver * previousReceiver = Receiver;
+    const SourceMethods previousMethods = ReceiverMethods;
+    mtsATINetFTTransportBusyPoll * previousBusyPoll = BusyPollTransport;
+    const bool previousSendCommands = SendCommands;
+    const bool previousUseClockModel = UseClockModel;
+
+    // a custom port can't be bound twice, close the current source first
+    const bool closeFirst = (previous.TransportType == "socket") && (source.TransportType == "socket")
+        && (previous.Protocol != mtsATINetFTReceiver::RDT) && (source.Protocol != mtsATINetFTReceiver::RDT)
+        && (previous.Port == source.Port);
+    if (closeFirst) {
+        CloseSource(previousSocket, previousReceiver, previousSendCommands);
+    }
+
+    SetSourceSettings(source);
+    Socket = new osaSocket(osaSocket::UDP);
+    Receiver = 0;
+    BusyPollTransport = 0;
+    const bool isOpen = OpenSource();
+    if (!isOpen) {
+        NumberOfFailedSwitches.fetch_add(1, std::memory_order_relaxed);
+        delete Receiver;
+        Socket->Close();
+        delete Socket;
+        SetSourceSettings(previous);
+        if (closeFirst) {
+            // can't reuse the closed socket, open the previous source again
+            delete previousReceiver;
+            delete previousSocket;
+            Socket = new osaSocket(osaSocket::UDP);
+            Receiver = 0;
+            BusyPollTransport = 0;
+            OpenSource();
+            IsConnected = false;
+            MeasuringInterruption = true;
+        } else {
+            Socket = previousSocket;
+            Receiver = previousReceiver;
+            ReceiverMethods = previousMethods;
+            BusyPollTransport = previousBusyPoll;
+            SendCommands = previousSendCommands;
+            UseClockModel = previousUseClockModel;
+            UseInjection.store(TransportType == "injection", std::memory_order_release);
+        }
+        UpdateBusyPollTimes();
+        StartReceiveThread();
+        return false;
+    }
+
+    if (!closeFirst) {
+        CloseSource(previousSocket, previousReceiver, previousSendCommands);
+    }
+    delete previousReceiver;
+    delete previousSocket;
+
+    // new sensor, start streaming in Run and learn its rate and clock again
+    IsConnected = false;
+    IsReceiving = false;
+    Watchdog.Reset();
+    IsStalled.store(false, std::memory_order_relaxed);
+    ClockModel.Reset();
+    UpdateBusyPollTimes();
+    StartReceiveThread();
+
+    MeasuringInterruption = true;
+    NumberOfSourceSwitches.fetch_add(1, std::memory_order_relaxed);
+    const double blocking = mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime() - start;
+    LastSwitchBlocking.store(blocking, std::memory_order_relaxed);
+    CMN_LOG_CLASS_RUN_VERBOSE << "SwitchSource: switched to " << Receiver->GetName() << " transport with "
+                              << Receiver->GetProtocolName() << " protocol in " << blocking << " s" << std::endl;
+    return true;
+}
+
+void mtsATINetFTSensor::StartReceiveThread(void)
+{
+    if (UseReceiveThread) {
+        if (!ReceiveThread) {
+            ReceiveThread = new mtsATINetFTReceiveThread(ReceiveQueueSize);
+            ReceiveThread->SetTrace(Trace, TRACE_RECEIVE);
+        }
+        (this->*ReceiverMethods.StartThread)();
+    }
+    SelectReceiveMethod();
+}
+
+template <class _source>
+void mtsATINetFTSensor::StartSourceThread(void)
+{
+    ReceiveThread->Start(static_cast<_source *>(Receiver), SocketTimeout,
+                         ReceiveThreadCPU, ReceiveThreadPriority);
+}
+
+void mtsATINetFTSensor::StopReceiveThread(void)
+{
+    if (!ReceiveThread) {
+        return;
+    }
+    ReceiveThread->Stop();
+    if (UseRawGauges) {
+        while (ReceiveThread->Pop(Packet)) {
+            ProcessSample<true>(&Packet);
+        }
+    } else {
+        while (ReceiveThread->Pop(Packet)) {
+            ProcessSample<false>(&Packet);
+        }
+    }
+}
+
+void mtsATINetFTSensor::SelectReceiveMethod(void)
+{
+    if (ReceiveThread) {
+        ReceiveAndProcess = UseRawGauges ?
+            &mtsATINetFTSensor::ReceiveFromThread<true> : &mtsATINetFTSensor::ReceiveFromThread<false>;
+    } else {
+        ReceiveAndProcess = UseRawGauges ? ReceiverMethods.RawGauges : ReceiverMethods.Counts;
+    }
+}
+
+void mtsATINetFTSensor::Reconfigure(const std::string & configuration)
+{
+#if CISST_HAS_JSON
+    Json::Value jsonConfig, jsonValue;
+    Json::Reader jsonReader;
+    if (!jsonReader.parse(configuration, jsonConfig) || !jsonConfig.isObject()) {
+        CMN_LOG_CLASS_RUN_ERROR << "Reconfigure: failed to parse \"" << configuration << "\"" << std::endl
+                                << jsonReader.getFormattedErrorMessages();
+        EventTriggers.ErrorMsg(std::string("Reconfigure: failed to parse configuration"));
+        return;
+    }
+
+    // data source, all changes applied at once
+    SourceSettings source;
+    GetSourceSettings(source);
+    bool sourceChanged = false;
+    jsonValue = jsonConfig["ip"];
+    if (!jsonValue.empty()) {
+        source.IP = jsonValue.asString();
+        sourceChanged = true;
+    }
+    jsonValue = jsonConfig["protocol"];
+    if (!jsonValue.empty()) {
+        if (!mtsATINetFTReceiver::ProtocolFromString(jsonValue.asString(), source.Protocol)) {
+            CMN_LOG_CLASS_RUN_ERROR << "Reconfigure: invalid \"protocol\" \"" << jsonValue.asString()
+                                    << "\", must be \"rdt\", \"custom\" or \"custom-versioned\"" << std::endl;
+            EventTriggers.ErrorMsg(std::string("Reconfigure: invalid protocol"));
+            return;
+        }
+        if ((source.Protocol == mtsATINetFTReceiver::RDT) && (ReceiveProtocol != mtsATINetFTReceiver::RDT)) {
+            source.Port = ATI_PORT;
+        }
+        sourceChanged = true;
+    }
+    jsonValue = jsonConfig["port"];
+    if (!jsonValue.empty()) {
+        source.Port = jsonValue.asInt();
+        sourceChanged = true;
+    }
+    const Json::Value jsonTransport = jsonConfig["transport"];
+    if (!jsonTransport.empty()) {
+        source.TransportType = jsonTransport.get("type", "socket").asString();
+        source.TransportSource = jsonTransport.get("name", "").asString();
+        if (source.TransportType == "replay") {
+            source.TransportSource = jsonTransport.get("file", "").asString();
+        }
+        source.TransportLoop = jsonTransport.get("loop", false).asBool();
+        source.TransportSpeed = jsonTransport.get("speed", 1.0).asDouble();
+        sourceChanged = true;
+    }
+    jsonValue = jsonConfig["receive-backend"];
+    if (!jsonValue.empty()) {
+        source.ReceiveBackend = jsonValue.asString();
+        sourceChanged = true;
+    }
+
+    if (sourceChanged) {
+        std::string error;
+        const bool useSocket = (source.TransportType == "socket");
+        if (!useSocket && (source.TransportType != "replay")
+            && (source.TransportType != "shared-memory") && (source.TransportType != "injection")) {
+            error = "invalid transport \"" + source.TransportType + "\"";
+        } else if (((source.TransportType == "replay") || (source.TransportType == "shared-memory"))
+                   && source.TransportSource.empty()) {
+            error = "transport \"" + source.TransportType + "\" requires a file or shared memory name";
+        } else if (useSocket && (source.Protocol != mtsATINetFTReceiver::RDT) && (source.Port == 0)) {
+            error = "\"port\" must be defined for custom protocols";
+        } else if (OnDemand && !(useSocket && (source.Protocol == mtsATINetFTReceiver::RDT))) {
+            error = "\"on-demand\" acquisition mode requires the rdt protocol";
+        } else if (UseRawGauges && useSocket && (source.Protocol == mtsATINetFTReceiver::RDT)) {
+            error = "raw gauges are only supported with the custom protocols";
+        }
+        if (!error.empty()) {
+            NumberOfFailedSwitches.fetch_add(1, std::memory_order_relaxed);
+            CMN_LOG_CLASS_RUN_ERROR << "Reconfigure: " << error << ", source not changed" << std::endl;
+            EventTriggers.ErrorMsg(std::string("Reconfigure: ") + error);
+            return;
+        }
+        if (!SwitchSource(source)) {
+            CMN_LOG_CLASS_RUN_ERROR << "Reconfigure: failed to open new source, source not changed" << std::endl;
+            EventTriggers.ErrorMsg(std::string("Reconfigure: failed to open new source"));
+        }
+    }
+
+    jsonValue = jsonConfig["socket-timeout"];
+    if (!jsonValue.empty()) {
+        SetSocketTimeout(jsonValue.asDouble());
+    }
+    jsonValue = jsonConfig["calibration-file"];
+    if (!jsonValue.empty()) {
+        LoadCalibrationFile(jsonValue.asString());
+    }
+    jsonValue = jsonConfig["filter"];
+    if (!jsonValue.empty()) {
+        SetFilter(jsonValue.asString());
+    }
+    // output channels filters, all checked before any is changed
+    const Json::Value jsonChannels = jsonConfig["channels"];
+    std::string error;
+    for (Json::ArrayIndex index = 0; error.empty() && (index < jsonChannels.size()); ++index) {
+        const Json::Value jsonChannel = jsonChannels[index];
+        const std::string name = jsonChannel.get("name", "").asString();
+        if (!GetOutputChannel(name)) {
+            error = "no channel \"" + name + "\"";
+        } else if (!jsonChannel["history-depth"].empty()) {
+            error = "\"history-depth\" of channel \"" + name + "\" can't be changed while running";
+        } else if ((jsonChannel.get("decimation", 1).asInt() < 1)
+                   || (jsonChannel.get("cutoff-ratio", 0.5).asDouble() <= 0.0)
+                   || (jsonChannel.get("cutoff-ratio", 0.5).asDouble() > 1.0)) {
+            error = "invalid \"decimation\" or \"cutoff-ratio\" for channel \"" + name + "\"";
+        }
+    }
+    if (!error.empty()) {
+        CMN_LOG_CLASS_RUN_ERROR << "Reconfigure: " << error << ", channels not changed" << std::endl;
+        EventTriggers.ErrorMsg(std::string("Reconfigure: ") + error);
+        return;
+    }
+    for (Json::ArrayIndex index = 0; index < jsonChannels.size(); ++index) {
+        const Json::Value jsonChannel = jsonChannels[index];
+        const std::string name = jsonChannel["name"].asString();
+        const mtsATINetFTOutputChannel * channel = GetOutputChannel(name);
+        SetOutputChannelFilter(name,
+                               jsonChannel.get("decimation", channel->GetDecimation()).asUInt(),
+                               jsonChannel.get("cutoff-ratio", channel->GetCutoffRatio()).asDouble());
+    }
+#else
+    CMN_LOG_CLASS_RUN_ERROR << "Reconfigure: cisst was compiled without JSON support, can't parse \""
+                            << configuration << "\"" << std::endl;
+    EventTriggers.ErrorMsg(std::string("Reconfigure: JSON not supported"));
+#endif
+}
+
+void mtsATINetFTSensor::SetSocketTimeout(const double & timeout)
+{
+    if (timeout <= 0.0) {
+        CMN_LOG_CLASS_RUN_ERROR << "SetSocketTimeout: timeout must be positive, got " << timeout << std::endl;
+        EventTriggers.ErrorMsg(std::string("SetSocketTimeout: timeout must be positive"));
+        return;
+    }
+    // used from the next receive, the receive thread only uses it to check if it should stop
+    SocketTimeout = timeout;
+    CMN_LOG_CLASS_RUN_VERBOSE << "SetSocketTimeout: " << timeout << " s" << std::endl;
+}
+
+void mtsATINetFTSensor::LoadCalibrationFile(const std::string & filename)
+{
+    const double start = mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime();
+    if (!LoadCalibration(filename)) {
+        CMN_LOG_CLASS_RUN_ERROR << "LoadCalibrationFile: failed to load \"" << filename
+                                << "\", calibration not changed" << std::endl;
+        EventTriggers.ErrorMsg(std::string("LoadCalibrationFile: failed to load ") + filename);
+        return;
+    }
+    CMN_LOG_CLASS_RUN_VERBOSE << "LoadCalibrationFile: loaded \"" << filename << "\" ("
+                              << NetFTConfig.CalibInfo.SerialNumber << ") in "
+                              << mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime() - start
+                              << " s" << std::endl;
+}
+
+bool mtsATINetFTSensor::LoadCalibration(const std::string & filename)
+{
+    // parsed aside so a bad file doesn't change the current calibration
+    mtsATINetFTConfig config;
+    if (!config.LoadCalibrationFile(filename)) {
+        return false;
+    }
+    // before Startup, raw gauges are configured in ConfigureGaugeCalibration
+    if (UseRawGauges && Receiver) {
+        if (!GaugeCalibration.Set(config)) {
+            return false;
+        }
+        if (HasGaugeOffsets) {
+            GaugeCalibration.SetOffsets(GaugeOffsets.Pointer());
+        }
+    }
+    NetFTConfig = config;
+    for (size_t i = 0; i < 6; ++i) {
+        MaxRatings[i].store(NetFTConfig.GenInfo.MaxRatings[i], std::memory_order_relaxed);
+    }
+    IsCalibFileLoaded = true;
+    return true;
+}
+
+void mtsATINetFTSensor::GetReconfiguration(mtsDoubleVec & reconfiguration) const
+{
+    reconfiguration.SetSize(5);
+    reconfiguration[0] = static_cast<double>(NumberOfSourceSwitches.load(std::memory_order_relaxed));
+    reconfiguration[1] = static_cast<double>(NumberOfFailedSwitches.load(std::memory_order_relaxed));
+    reconfiguration[2] = LastInterruption.load(std::memory_order_relaxed);
+    reconfiguration[3] = LongestInterruption.load(std::memory_order_relaxed);
+    reconfiguration[4] = LastSwitchBlocking.load(std::memory_order_relaxed);
+}
+
+void mtsATINetFTSensor::SetBusyPoll(const double spinTime, const double yieldTime,
+                                    const int socketBusyPoll)
+{
+    BusyPollSpinTime = spinTime;
+    BusyPollYieldTime = yieldTime;
+    BusyPollSocket = socketBusyPoll;
+}
+
+void mtsATINetFTSensor::UpdateBusyPollTimes(void)
+{
+    double times[3] = {0.0, 0.0, 0.0};
+#if (CISST_OS != CISST_WINDOWS)
+    if (BusyPollTransport) {
+        mtsATINetFTTransportBusyPoll::Times busyPollTimes;
+        BusyPollTransport->GetTimes(busyPollTimes);
+        times[0] = busyPollTimes.Spinning;
+        times[1] = busyPollTimes.Yielding;
+        times[2] = busyPollTimes.Productive;
+    }
+#endif
+    for (size_t i = 0; i < 3; ++i) {
+        BusyPollTimes[i].store(times[i], std::memory_order_relaxed);
+    }
+}
+
+void mtsATINetFTSensor::GetBusyPollTimes(mtsDoubleVec & times) const
+{
+    // the transport can be deleted by SwitchSource, only read the copies
+    times.SetSize(3);
+    for (size_t i = 0; i < 3; ++i) {
+        times[i] = BusyPollTimes[i].load(std::memory_order_relaxed);
+    }
+}
+
+void mtsATINetFTSensor::SetClockModel(const bool enabled, const double timeConstant,
+                                      const double latency)
+{
+    ClockModelEnabled = enabled;
+    UseClockModel = enabled;
+    ClockModel.SetTimeConstant(timeConstant);
+    ClockModel.SetLatency(latency);
+}
+
+void mtsATINetFTSensor::GetClockModel(mtsDoubleVec & model) const
+{
+    model.SetSize(4);
+    model[0] = ClockPeriod.load(std::memory_order_relaxed);
+    model[1] = ClockJitter.load(std::memory_order_relaxed);
+    model[2] = static_cast<double>(ClockResets.load(std::memory_order_relaxed));
+    model[3] = static_cast<double>(ClockLatePackets.load(std::memory_order_relaxed));
+}
+
+void mtsATINetFTSensor::SetAcquisitionMode(const std::string & mode)
+{
+    if (mode == "continuous") {
+        OnDemand = false;
+    } else if (mode == "on-demand") {
+        OnDemand = true;
+    } else {
+        CMN_LOG_CLASS_INIT_ERROR << "SetAcquisitionMode: invalid mode \"" << mode
+                                 << "\", must be \"continuous\" or \"on-demand\"" << std::endl;
+    }
+}
+
+bool mtsATINetFTSensor::SendStreamingRequest(const uint16_t command, const uint32_t numberOfSamples)
+{
+    *(uint16*)&(Data->Request)[0] = htons(0x1234);
+    *(uint16*)&(Data->Request)[2] = htons(command);
+    *(uint32*)&(Data->Request)[4] = htonl(numberOfSamples);
+    const int result = Socket->Send((const char *)(Data->Request), 8, SocketTimeout);
+    *(uint32*)&(Data->Request)[4] = htonl(ATI_NUM_SAMPLES);
+    if (result == -1) {
+        CMN_LOG_CLASS_RUN_WARNING << "SendStreamingRequest: UDP send failed" << std::endl;
+        return false;
+    }
+    StreamingRequestTime = mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime();
+    return true;
+}
+
+bool mtsATINetFTSensor::UpdateStreaming(void)
+{
+    const int streaming = Streaming.load(std::memory_order_relaxed);
+    if (NumberOfSubscribers > 0) {
+        // bursts are counted on the continuous stream
+        if ((streaming != STREAMING_CONTINUOUS) || !IsConnected) {
+            if (SendStreamingRequest(ATI_COMMAND, 0)) {
+                IsConnected = true;
+                Streaming = STREAMING_CONTINUOUS;
+            }
+        }
+    } else if (BurstRemaining > 0) {
+        // sensor stops by itself after the number of samples requested
+        if ((streaming != STREAMING_BURST) || BurstChanged || !IsConnected) {
+            if (SendStreamingRequest(ATI_COMMAND, BurstRemaining)) {
+                IsConnected = true;
+                Streaming = STREAMING_BURST;
+            }
+            BurstChanged = false;
+        }
+    } else if (streaming == STREAMING_CONTINUOUS) {
+        // nobody is listening anymore
+        SendStreamingRequest(0x0000, 0);
+        Streaming = STREAMING_STOPPED;
+        IsReceiving = false;
+        Watchdog.Reset();
+    }
+    return Streaming.load(std::memory_order_relaxed) != STREAMING_STOPPED;
+}
+
+void mtsATINetFTSensor::CountBurstSample(void)
+{
+    if (BurstRemaining == 0) {
+        return;
+    }
+    ++BurstReceived;
+    --BurstRemaining;
+    if (BurstRemaining == 0) {
+        EndBurst();
+    }
+}
+
+void mtsATINetFTSensor::EndBurst(void)
+{
+    EventTriggers.BurstCompleted(static_cast<int>(BurstReceived));
+    if (BurstRemaining > 0) {
+        CMN_LOG_CLASS_RUN_WARNING << "EndBurst: received " << BurstReceived << " samples, "
+                                  << BurstRemaining << " missing" << std::endl;
+    }
+    BurstRemaining = 0;
+    BurstReceived = 0;
+    if (Streaming.load(std::memory_order_relaxed) == STREAMING_BURST) {
+        Streaming = STREAMING_STOPPED;
+        IsReceiving = false;
+        Watchdog.Reset();
+    }
+}
+
+void mtsATINetFTSensor::RequestSamples(const int & numberOfSamples)
+{
+    if (!OnDemand || !SendCommands) {
+        CMN_LOG_CLASS_RUN_WARNING << "RequestSamples: only supported in \"on-demand\" mode with rdt protocol"
+                                  << std::endl;
+        return;
+    }
+    if (numberOfSamples <= 0) {
+        return;
+    }
+    BurstRemaining += static_cast<uint32_t>(numberOfSamples);
+    BurstChanged = true;
+}
+
+void mtsATINetFTSensor::Subscribe(void)
+{
+    ++NumberOfSubscribers;
+}
+
+void mtsATINetFTSensor::Unsubscribe(void)
+{
+    if (NumberOfSubscribers > 0) {
+        --NumberOfSubscribers;
+    }
+}
+
+void mtsATINetFTSensor::GetStreamingState(std::string & state) const
+{
+    if (!OnDemand) {
+        state = "continuous";
+        return;
+    }
+    switch (Streaming.load(std::memory_order_relaxed)) {
+    case STREAMING_BURST:
+        state = "burst";
+        break;
+    case STREAMING_CONTINUOUS:
+        state = "streaming";
+        break;
+    default:
+        state = "stopped";
+    }
+}
+
+void mtsATINetFTSensor::SetStallWatchdog(const double missedIntervals)
+{
+    Watchdog.SetMissedIntervals(missedIntervals);
+}
+
+void mtsATINetFTSensor::GetIsStalled(bool & isStalled) const
+{
+    isStalled = IsStalled.load(std::memory_order_relaxed);
+}
+
+void mtsATINetFTSensor::GetWatchdog(mtsDoubleVec & watchdog) const
+{
+    watchdog.SetSize(4);
+    watchdog[0] = WatchdogInterval.load(std::memory_order_relaxed);
+    watchdog[1] = WatchdogThreshold.load(std::memory_order_relaxed);
+    watchdog[2] = static_cast<double>(NumberOfStalls.load(std::memory_order_relaxed));
+    watchdog[3] = static_cast<double>(NumberOfDisconnects.load(std::memory_order_relaxed));
+}
+
+double mtsATINetFTSensor::GetReceiveTimeout(void) const
+{
+    if (!IsReceiving) {
+        return SocketTimeout;
+    }
+    // wake up in time for the watchdog and the socket timeout since the last packet
+    const double now = mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime();
+    double deadline = LastPacketTime + SocketTimeout;
+    const double watchdogDeadline = Watchdog.GetDeadline();
+    if ((watchdogDeadline >= 0.0) && (watchdogDeadline < deadline)) {
+        deadline = watchdogDeadline;
+    }
+    const double timeout = deadline - now;
+    if (timeout <= 0.0) {
+        return 0.0;
+    }
+    return (timeout < SocketTimeout) ? timeout : SocketTimeout;
+}
+
+void mtsATINetFTSensor::ProcessReceiveTimeout(void)
+{
+    const double now = mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime();
+    // burst with lost packets, the sensor already stopped
+    if ((Streaming.load(std::memory_order_relaxed) == STREAMING_BURST) && (BurstReceived > 0)
+        && (now - LastPacketTime >= SocketTimeout)) {
+        EndBurst();
+        return;
+    }
+    if (Watchdog.Check(now)) {
+        IsStalled.store(true, std::memory_order_relaxed);
+        NumberOfStalls.fetch_add(1, std::memory_order_relaxed);
+        CMN_LOG_CLASS_RUN_WARNING << "ProcessReceiveTimeout: stream stalled, no sample for "
+                                  << now - LastPacketTime << " s (expected interval "
+                                  << Watchdog.GetExpectedInterval() << " s)" << std::endl;
+        EventTriggers.Stalled(now - LastPacketTime);
+    }
+    // the sensor is disconnected only after the socket timeout
+    if (IsReceiving && (now - LastPacketTime < SocketTimeout)) {
+        return;
+    }
+    if (IsReceiving) {
+        IsReceiving = false;
+        NumberOfDisconnects.fetch_add(1, std::memory_order_relaxed);
+        EventTriggers.Disconnected(now - LastPacketTime);
+        // rate might be different when the sensor comes back
+        Watchdog.Reset();
+        IsStalled.store(false, std::memory_order_relaxed);
+    }
+    // no packet, the decoder is not used
+    ProcessSample<false>(0);
+}
+
+void mtsATINetFTSensor::SetReceiveThread(const bool enabled, const int cpu, const int priority,
+                                         const size_t queueSize)
+{
+    UseReceiveThread = enabled;
+    ReceiveThreadCPU = cpu;
+    ReceiveThreadPriority = priority;
+    ReceiveQueueSize = queueSize;
+}
+
+void mtsATINetFTSensor::SetSharedMemory(const std::string & name, const unsigned int capacity)
+{
+    SharedMemoryName = name;
+    SharedMemoryCapacity = capacity;
+}
+
+void mtsATINetFTSensor::SetMulticast(const std::string & group, const int port,
+                                     const size_t samplesPerDatagram, const int ttl,
+                                     const std::string & interfaceAddress)
+{
+    MulticastGroup = group;
+    MulticastPort = port;
+    MulticastSamplesPerDatagram = samplesPerDatagram;
+    MulticastTTL = ttl;
+    MulticastInterface = interfaceAddress;
+}
+
+void mtsATINetFTSensor::Run(void)
+{
+    if (ConfigurationFailed) {
+        // not started, only answer commands
+        ProcessQueuedCommands();
+        osaSleep(SocketTimeout);
+        return;
+    }
+    if (BusyPollTransport) {
+        UpdateBusyPollTimes();
+    }
+    if (OnDemand) {
+        ProcessCommands();
+        if (!UpdateStreaming()) {
+            // nothing to receive, just wait for commands
+            osaSleep(SocketTimeout);
+            return;
+        }
+    } else {
+        if (!IsConnected && (TransportType == "socket")) {
+            // Start streaming
+            *(uint16*)&(Data->Request)[2] = htons(ATI_COMMAND);
+            int result = Socket->Send((const char *)(Data->Request), 8, SocketTimeout);
+            if (result == -1) {
+                IsConnected = false;
+                CMN_LOG_CLASS_RUN_WARNING << "Run: UDP send failed" << std::endl;
+                ProcessSample<false>(0);
+                return;
+            } else {
+                IsConnected = true;
+            }
+        }
+        ProcessCommands();
+    }
+
+    // compiled for the source and decoder, see SelectReceiveMethod
+    (this->*ReceiveAndProcess)(GetReceiveTimeout());
+}
+
+template <class _source, bool _rawGauges>
+void mtsATINetFTSensor::ReceiveFromSource(const double timeout)
+{
+    _source * source = static_cast<_source *>(Receiver);
+    double begin = Trace ? mtsATINetFTTrace::GetTime() : 0.0;
+    if (!source->Receive(Packet, timeout)) {
+        if (Trace) {
+            Trace->Record(TRACE_COMPONENT, mtsATINetFTTrace::RECEIVE_TIMEOUT, begin, mtsATINetFTTrace::GetTime());
+        }
+        ProcessReceiveTimeout();
+        return;
+    }
+    // then the packets already received, one state table row per sample
+    size_t count = 0;
+    do {
+        if (Trace) {
+            // the transport timestamps the datagram when it is received
+            const double end = mtsATINetFTTrace::GetTime();
+            Trace->Record(TRACE_COMPONENT, mtsATINetFTTrace::RECEIVE_WAIT, begin, Packet.ReceiveTime, Packet.RdtSequence);
+            Trace->Record(TRACE_COMPONENT, mtsATINetFTTrace::DECODE, Packet.ReceiveTime, end, Packet.RdtSequence);
+        }
+        ProcessSample<_rawGauges>(&Packet);
+        if (Trace) {
+            begin = mtsATINetFTTrace::GetTime();
+        }
+    } while ((++count < MAX_PACKETS_PER_RUN) && source->Receive(Packet, 0.0));
+}
+
+template <bool _rawGauges>
+void mtsATINetFTSensor::ReceiveFromThread(const double timeout)
+{
+    // drain all packets queued by the receive thread, one state table row per sample
+    if (ReceiveThread->IsEmpty()) {
+        const double begin = Trace ? mtsATINetFTTrace::GetTime() : 0.0;
+        ReceiveThread->Wait(timeout);
+        if (Trace) {
+            Trace->Record(TRACE_COMPONENT, mtsATINetFTTrace::QUEUE_WAIT, begin, mtsATINetFTTrace::GetTime());
+        }
+    }
+    bool received = false;
+    while (ReceiveThread->Pop(Packet)) {
+        ProcessSample<_rawGauges>(&Packet);
+        received = true;
+    }
+    if (!received) {
+        ProcessReceiveTimeout();
+    }
+}
+
+void mtsATINetFTSensor::ProcessCommands(void)
+{
+    if (!Trace) {
+        ProcessQueuedCommands();
+        return;
+    }
+    const double begin = mtsATINetFTTrace::GetTime();
+    ProcessQueuedCommands();
+    Trace->Record(TRACE_COMPONENT, mtsATINetFTTrace::COMMANDS, begin, mtsATINetFTTrace::GetTime());
+}
+
+template <bool _rawGauges>
+void mtsATINetFTSensor::ProcessSample(const mtsATINetFTPacket * packet)
+{
+    const double begin = Trace ? mtsATINetFTTrace::GetTime() : 0.0;
+    StateTable.Start();
+    if (packet) {
+        IsReceiving = true;
+        LastPacketTime = packet->ReceiveTime;
+        if (Watchdog.Sample(packet->ReceiveTime)) {
+            IsStalled.store(false, std::memory_order_relaxed);
+            CMN_LOG_CLASS_RUN_VERBOSE << "ProcessSample: stream resumed" << std::endl;
+        }
+        WatchdogInterval.store(Watchdog.GetExpectedInterval(), std::memory_order_relaxed);
+        WatchdogThreshold.store(Watchdog.GetThreshold(), std::memory_order_relaxed);
+        if (MeasuringInterruption) {
+            // first sample since the source changed
+            MeasuringInterruption = false;
+            const double interruption = packet->ReceiveTime - InterruptionStart;
+            LastInterruption.store(interruption, std::memory_order_relaxed);
+            if (interruption > LongestInterruption.load(std::memory_order_relaxed)) {
+                LongestInterruption.store(interruption, std::memory_order_relaxed);
+            }
+            CMN_LOG_CLASS_RUN_VERBOSE << "ProcessSample: first sample from new source after "
+                                      << interruption << " s" << std::endl;
+        }
+        DecodePacket<_rawGauges>(*packet);
+    } else {
+        if (UseCustomPort) {
+            CMN_LOG_CLASS_RUN_WARNING << "Run: UDP receive from xPC failed" << std::endl;
+        }
+        // If there are packets missing, previous FT will be returned when queried
+        IsConnected = false;
+        RawSample.SetValid(false);
+        RawSample.SetTimestamp(mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime());
+    }
+
+    if (IsSaturated || HasError) {
+        CMN_LOG_CLASS_RUN_WARNING << "Run: sensor saturated or has error" << std::endl;
+        RawSample.SetValid(false);
+    }
+
+    if (packet) {
+        UpdateSample(*packet);
+        DetectContactAndOverload();
+        if (ContactDetector.IsActive()) {
+            Sample.Flags |= ATI_NETFT_SHM_CONTACT;
+        }
+        if (OverloadDetector.IsActive()) {
+            Sample.Flags |= ATI_NETFT_SHM_OVERLOAD;
+        }
+        LatestSample.Write(Sample);
+        for (size_t i = 0; i < OutputChannels.size(); ++i) {
+            OutputChannels[i]->Update(Sample);
+        }
+        if (Sample.Flags & ATI_NETFT_SHM_VALID) {
+            for (size_t i = 0; i < StatisticsWindows.size(); ++i) {
+                StatisticsWindows[i]->Add(Sample.ForceTorque, Sample.Timestamp);
+            }
+        }
+        if (Capture && Capture->Add(Sample)) {
+            EventTriggers.CaptureTriggered(std::string(Capture->GetLastReason()));
+        }
+    }
+    if (SharedMemory) {
+        PublishSharedMemory(packet != 0);
+    }
+#if (CISST_OS != CISST_WINDOWS)
+    if (Multicast) {
+        if (packet) {
+            Multicast->Add(Sample);
+        } else {
+            Multicast->Flush();
+        }
+    }
+#endif
+    UpdateFlags();
+    const double commit = Trace ? mtsATINetFTTrace::GetTime() : 0.0;
+    StateTable.Advance();
+    // after Advance so the last sample is readable when the burst ends
+    if (packet && OnDemand) {
+        CountBurstSample();
+    }
+    if (Trace) {
+        const double end = mtsATINetFTTrace::GetTime();
+        const uint32_t sequence = packet ? packet->RdtSequence : 0;
+        Trace->Record(TRACE_COMPONENT, mtsATINetFTTrace::COMMIT, commit, end, sequence);
+        Trace->Record(TRACE_COMPONENT, mtsATINetFTTrace::PROCESS_SAMPLE, begin, end, sequence);
+    }
+}
+
+void mtsATINetFTSensor::UpdateFlags(void)
+{
+    uint32_t flags = 0;
+    if (RawSample.Valid()) {
+        flags |= ATI_NETFT_SHM_VALID;
+    }
+    if (IsConnected) {
+        flags |= ATI_NETFT_SHM_CONNECTED;
+    }
+    if (IsSaturated) {
+        flags |= ATI_NETFT_SHM_SATURATED;
+    }
+    if (HasError) {
+        flags |= ATI_NETFT_SHM_ERROR;
+    }
+    if (ContactDetector.IsActive()) {
+        flags |= ATI_NETFT_SHM_CONTACT;
+    }
+    if (OverloadDetector.IsActive()) {
+        flags |= ATI_NETFT_SHM_OVERLOAD;
+    }
+    RawSample.Flags = flags;
+}
+
+void mtsATINetFTSensor::UpdateSample(const mtsATINetFTPacket & packet)
+{
+    Sample.Index = LatestSample.GetCount();
+    Sample.Timestamp = RawSample.Timestamp();
+    Sample.RdtSequence = packet.RdtSequence;
+    Sample.FtSequence = packet.FtSequence;
+    Sample.Status = packet.Status;
+    Sample.Flags = ATI_NETFT_SHM_CONNECTED;
+    if (RawSample.Valid()) {
+        Sample.Flags |= ATI_NETFT_SHM_VALID;
+    }
+    if (IsSaturated) {
+        Sample.Flags |= ATI_NETFT_SHM_SATURATED;
+    }
+    if (HasError) {
+        Sample.Flags |= ATI_NETFT_SHM_ERROR;
+    }
+    RawSample.GetForceTorque(Sample.ForceTorque);
+}
+
+void mtsATINetFTSensor::DetectContactAndOverload(void)
+{
+    if (!(Sample.Flags & ATI_NETFT_SHM_VALID) && !IsSaturated) {
+        return;
+    }
+    const double * ft = Sample.ForceTorque;
+    mtsATINetFTHysteresis::Transition contact = mtsATINetFTHysteresis::NONE;
+    if (ContactDetector.IsEnabled() && (Sample.Flags & ATI_NETFT_SHM_VALID)) {
+        contact = ContactDetector.Update(std::sqrt(ft[0] * ft[0] + ft[1] * ft[1] + ft[2] * ft[2]));
+    }
+    mtsATINetFTHysteresis::Transition overload = mtsATINetFTHysteresis::NONE;
+    if (OverloadDetector.IsEnabled()) {
+        // saturation counts as 100% of range
+        double percent = IsSaturated ? 100.0 : 0.0;
+        if (IsCalibFileLoaded && (Sample.Flags & ATI_NETFT_SHM_VALID)) {
+            for (size_t i = 0; i < 6; ++i) {
+                const double axis = 100.0 * std::fabs(ft[i]) / MaxRatings[i].load(std::memory_order_relaxed);
+                if (axis > percent) {
+                    percent = axis;
+                }
+            }
+        }
+        overload = OverloadDetector.Update(percent);
+    }
+    if ((contact == mtsATINetFTHysteresis::NONE)
+        && (overload == mtsATINetFTHysteresis::NONE)) {
+        return;
+    }
+
+    // event payload is the sample that caused the transition
+    DetectionSample.SetForce(vctDouble6(ft[0], ft[1], ft[2], ft[3], ft[4], ft[5]));
+    DetectionSample.SetTimestamp(Sample.Timestamp);
+    DetectionSample.SetValid(Sample.Flags & ATI_NETFT_SHM_VALID);
+    if (contact == mtsATINetFTHysteresis::ACTIVATED) {
+        EventTriggers.ContactDetected(DetectionSample);
+    } else if (contact == mtsATINetFTHysteresis::DEACTIVATED) {
+        EventTriggers.ContactLost(DetectionSample);
+    }
+    if (overload == mtsATINetFTHysteresis::ACTIVATED) {
+        EventTriggers.OverloadDetected(DetectionSample);
+    } else if (overload == mtsATINetFTHysteresis::DEACTIVATED) {
+        EventTriggers.OverloadCleared(DetectionSample);
+    }
+}
+
+void mtsATINetFTSensor::PublishSharedMemory(const bool newSample)
+{
+#if (CISST_OS != CISST_WINDOWS)
+    if (!SharedMemory->IsOpen()) {
+        return;
+    }
+    SharedMemory->SetConnected(IsConnected);
+    if (newSample) {
+        SharedMemory->Publish(Sample);
+    }
+#endif
+}
+
+template <bool _rawGauges>
+void mtsATINetFTSensor::DecodePacket(const mtsATINetFTPacket & packet)
+{
+    IsConnected = true;
+    HasError = packet.Error;
+    IsSaturated = packet.Saturated;
+    if (_rawGauges) {
+        // raw gauge values from a custom protocol
+        double forceTorque[6];
+        GaugeCalibration.Apply(packet.Values, forceTorque);
+        if (!RawSample.SetForceTorque(forceTorque)) {
+            IsSaturated = true;
+        }
+    } else {
+        // counts are stored as is, converted to doubles when read
+        for (size_t i = 0; i < 6; ++i) {
+            RawSample.Counts[i] = packet.Counts[i];
+        }
+        RawSample.CountsPerUnit = packet.CountsPerUnit;
+    }
+    RawSample.Status = packet.Status;
+    RawSample.RdtSequence = packet.RdtSequence;
+    RawSample.SetValid(true);
+
+    if (UseClockModel) {
+        RawSample.SetTimestamp(ClockModel.Update(packet.RdtSequence, packet.ReceiveTime));
+        ClockPeriod.store(ClockModel.GetPeriod(), std::memory_order_relaxed);
+        ClockJitter.store(ClockModel.GetJitter(), std::memory_order_relaxed);
+        ClockResets.store(ClockModel.GetNumberOfResets(), std::memory_order_relaxed);
+        ClockLatePackets.store(ClockModel.GetNumberOfLatePackets(), std::memory_order_relaxed);
+    } else {
+        RawSample.SetTimestamp(packet.ReceiveTime);
+    }
+}
+
+void mtsATINetFTSensor::ReportMemoryBudget(void)
+{
+    // each state table row also has the tick, Tic, Toc and Period columns
+    const size_t rowOverhead = sizeof(mtsStateIndex::TimeTicksType) + 3 * sizeof(mtsDouble);
+    const size_t rows = StateTable.GetHistoryLength();
+    const size_t rowSize = sizeof(mtsATINetFTRawSample) + rowOverhead;
+    size_t total = rows * rowSize;
+    std::stringstream report;
+    report << " history " << rows << " samples (" << rows / 7000.0 << " s at 7 kHz), "
+           << rowSize << " bytes per sample";
+    for (size_t i = 0; i < OutputChannels.size(); ++i) {
+        const size_t channelRows = OutputChannels[i]->StateTable->GetHistoryLength();
+        total += channelRows * (sizeof(prmForceCartesianGet) + rowOverhead);
+    }
+    if (!OutputChannels.empty()) {
+        report << ", " << OutputChannels.size() << " output channel(s)";
+    }
+    report << ", total " << static_cast<double>(total) / (1024.0 * 1024.0) << " MiB";
+    CMN_LOG_CLASS_INIT_WARNING << "ReportMemoryBudget: state tables for \""
+                               << this->GetName() << "\":" << report.str() << std::endl;
+}
+
+bool mtsATINetFTSensor::GetLatestRawSample(mtsATINetFTRawSample & sample) const
+{
+    if (!RawSampleAccessor) {
+        return false;
+    }
+    return RawSampleAccessor->GetLatest(sample);
+}
+
+void mtsATINetFTSensor::GetRawData(mtsDoubleVec & forceTorque) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    forceTorque.SetSize(6);
+    sample.GetForceTorque(forceTorque.Pointer());
+    forceTorque.SetValid(sample.Valid());
+    forceTorque.SetTimestamp(sample.Timestamp());
+}
+
+void mtsATINetFTSensor::GetMeasuredCF(prmForceCartesianGet & forceTorque) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    forceTorque.SetForce(sample.GetForceTorque());
+    forceTorque.SetValid(sample.Valid());
+    forceTorque.SetTimestamp(sample.Timestamp());
+}
+
+void mtsATINetFTSensor::GetMeasuredCFTool(prmForceCartesianGet & forceTorque) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    vctDouble6 tool;
+    ToolTransform.Apply(sample.GetForceTorque().Pointer(), tool.Pointer());
+    forceTorque.SetForce(tool);
+    forceTorque.SetValid(sample.Valid());
+    forceTorque.SetTimestamp(sample.Timestamp());
+}
+
+void mtsATINetFTSensor::GetPercentOfMax(mtsDoubleVec & percent) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    percent.SetSize(6);
+    // 100% if there is an error or is saturated
+    if (sample.HasFlag(ATI_NETFT_SHM_SATURATED) || sample.HasFlag(ATI_NETFT_SHM_ERROR)) {
+        percent.SetAll(100.0);
+    } else if (IsCalibFileLoaded) {
+        double forceTorque[6];
+        sample.GetForceTorque(forceTorque);
+        for (size_t i = 0; i < 6; ++i) {
+            percent[i] = 100.0 * std::fabs(forceTorque[i]) / MaxRatings[i].load(std::memory_order_relaxed);
+        }
+    } else {
+        percent.SetAll(0.0);
+    }
+    percent.SetValid(sample.Valid());
+    percent.SetTimestamp(sample.Timestamp());
+}
+
+void mtsATINetFTSensor::GetIsConnected(bool & isConnected) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    isConnected = sample.HasFlag(ATI_NETFT_SHM_CONNECTED);
+}
+
+void mtsATINetFTSensor::GetIsSaturated(bool & isSaturated) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    isSaturated = sample.HasFlag(ATI_NETFT_SHM_SATURATED);
+}
+
+void mtsATINetFTSensor::GetHasError(bool & hasError) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    hasError = sample.HasFlag(ATI_NETFT_SHM_ERROR);
+}
+
+void mtsATINetFTSensor::GetIsInContact(bool & isInContact) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    isInContact = sample.HasFlag(ATI_NETFT_SHM_CONTACT);
+}
+
+void mtsATINetFTSensor::GetIsOverloaded(bool & isOverloaded) const
+{
+    mtsATINetFTRawSample sample;
+    GetLatestRawSample(sample);
+    isOverloaded = sample.HasFlag(ATI_NETFT_SHM_OVERLOAD);
+}
+
+void mtsATINetFTSensor::ApplyFilter(const mtsDoubleVec & rawFT, mtsDoubleVec & filteredFT, const FilterType &filter)
+{
+    if(rawFT.size() != 6) {
+        CMN_LOG_CLASS_RUN_ERROR << "ApplyFilter: Size mismatch" << std::endl;
+        return;
+    }
+
+    if(filter == NO_FILTER) {
+        filteredFT = rawFT;
+    }
+}
+
+bool mtsATINetFTSensor::FilterFromString(const std::string & name, FilterType & filter)
+{
+    if (name == "NoFilter") {
+        filter = NO_FILTER;
+        return true;
+    }
+    return false;
+}
+
+void mtsATINetFTSensor::SetFilter(const std::string &filterName)
+{
+    FilterType filter;
+    if (!FilterFromString(filterName, filter)) {
+        CMN_LOG_CLASS_RUN_ERROR << "SetFilter: unknown filter \"" << filterName
+                                << "\", must be \"NoFilter\", use output channels for low pass filters" << std::endl;
+        EventTriggers.ErrorMsg(std::string("SetFilter: unknown filter ") + filterName);
+        return;
+    }
+    CurrentFilter = filter;
+}
+
+void mtsATINetFTSensor::Rebias(void)
+{
+    if (!SendCommands)
+        return;
+
+    *(uint16*)&(Data->Request)[2] = htons(0x0042);
+    int result = Socket->Send((const char *)(Data->Request), 8, SocketTimeout);
+    if (result == -1) {
+        IsConnected = false;
+        CMN_LOG_CLASS_RUN_WARNING << "Rebias: UDP send failed" << std::endl;
+        return;
+    }
+
+    EventTriggers.ErrorMsg(std::string("Sensor ReBiased"));
+    CMN_LOG_CLASS_RUN_VERBOSE << "FT Sensor Rebiased " << std::endl;
 }
@@ -0,0 +1,199 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cmath>
+#include <sawATIForceSensor/mtsATINetFTStatistics.h>
+
+mtsATINetFTStatistics::mtsATINetFTStatistics(const std::string & name,
+                                             const size_t windowSize):
+    Name(name),
+    WindowSize((windowSize > 0) ? windowSize : 1)
+{
+    Samples.resize(WindowSize);
+    for (size_t axis = 0; axis < 6; ++axis) {
+        Minimums[axis].Indices.resize(WindowSize);
+        Maximums[axis].Indices.resize(WindowSize);
+    }
+    Sequence.store(0, std::memory_order_relaxed);
+    Reset();
+}
+
+void mtsATINetFTStatistics::Reset(void)
+{
+    Count = 0;
+    Total = 0;
+    Offset.SetAll(0.0);
+    Sum.SetAll(0.0);
+    SumOfSquares.SetAll(0.0);
+    FreshCount = 0;
+    for (size_t axis = 0; axis < 6; ++axis) {
+        Minimums[axis].Head = Minimums[axis].Size = 0;
+        Maximums[axis].Head = Maximums[axis].Size = 0;
+    }
+    Publish(0.0);
+}
+
+void mtsATINetFTStatistics::Publish(const double timestamp)
+{
+    const uint32_t sequence = Sequence.load(std::memory_order_relaxed);
+    Sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    Published.Count = Count;
+    Published.Timestamp = timestamp;
+    Published.Offset = Offset;
+    Published.Sum = Sum;
+    Published.SumOfSquares = SumOfSquares;
+    if (Count > 0) {
+        for (size_t axis = 0; axis < 6; ++axis) {
+            Published.Minimum[axis] = Samples[Minimums[axis].Indices[Minimums[axis].Head] % WindowSize][axis];
+            Published.Maximum[axis] = Samples[Maximums[axis].Indices[Maximums[axis].Head] % WindowSize][axis];
+        }
+    } else {
+        Published.Minimum.SetAll(0.0);
+        Published.Maximum.SetAll(0.0);
+    }
+    Sequence.store(sequence + 2, std::memory_order_release);
+}
+
+void mtsATINetFTStatistics::PopExpired(MonotonicQueue & queue)
+{
+    // oldest index still in window is Total - Count
+    while ((queue.Size > 0) && (queue.Indices[queue.Head] + Count < Total)) {
+        queue.Head = (queue.Head + 1) % WindowSize;
+        --queue.Size;
+    }
+}
+
+void mtsATINetFTStatistics::PushMinimum(MonotonicQueue & queue, const size_t axis, const double value)
+{
+    while (queue.Size > 0) {
+        const size_t last = (queue.Head + queue.Size - 1) % WindowSize;
+        if (Samples[queue.Indices[last] % WindowSize][axis] < value) {
+            break;
+        }
+        --queue.Size;
+    }
+    queue.Indices[(queue.Head + queue.Size) % WindowSize] = Total - 1;
+    ++queue.Size;
+}
+
+void mtsATINetFTStatistics::PushMaximum(MonotonicQueue & queue, const size_t axis, const double value)
+{
+    while (queue.Size > 0) {
+        const size_t last = (queue.Head + queue.Size - 1) % WindowSize;
+        if (Samples[queue.Indices[last] % WindowSize][axis] > value) {
+            break;
+        }
+        --queue.Size;
+    }
+    queue.Indices[(queue.Head + queue.Size) % WindowSize] = Total - 1;
+    ++queue.Size;
+}
+
+void mtsATINetFTStatistics::Add(const double * forceTorque, const double timestamp)
+{
+    vct6 & slot = Samples[Total % WindowSize];
+    if (Count == WindowSize) {
+        // remove oldest sample from sums, it's about to be overwritten
+        for (size_t axis = 0; axis < 6; ++axis) {
+            const double old = slot[axis] - Offset[axis];
+            Sum[axis] -= old;
+            SumOfSquares[axis] -= old * old;
+        }
+    } else {
+        if (Count == 0) {
+            Offset.Assign(forceTorque);
+        }
+        ++Count;
+    }
+    slot.Assign(forceTorque);
+    ++Total;
+
+    for (size_t axis = 0; axis < 6; ++axis) {
+        const double value = slot[axis] - Offset[axis];
+        Sum[axis] += value;
+        SumOfSquares[axis] += value * value;
+        PopExpired(Minimums[axis]);
+        PopExpired(Maximums[axis]);
+        PushMinimum(Minimums[axis], axis, slot[axis]);
+        PushMaximum(Maximums[axis], axis, slot[axis]);
+    }
+
+    // removing values from sums accumulates rounding errors, fresh
+    // sums (centered on the mean when they start) only add new
+    // samples and replace the running sums once they cover the whole
+    // window, so there is no pass over the window
+    if (FreshCount == 0) {
+        for (size_t axis = 0; axis < 6; ++axis) {
+            FreshOffset[axis] = Offset[axis] + Sum[axis] / static_cast<double>(Count);
+        }
+        FreshSum.SetAll(0.0);
+        FreshSumOfSquares.SetAll(0.0);
+    }
+    for (size_t axis = 0; axis < 6; ++axis) {
+        const double value = slot[axis] - FreshOffset[axis];
+        FreshSum[axis] += value;
+        FreshSumOfSquares[axis] += value * value;
+    }
+    ++FreshCount;
+    if (FreshCount == WindowSize) {
+        Offset.Assign(FreshOffset);
+        Sum.Assign(FreshSum);
+        SumOfSquares.Assign(FreshSumOfSquares);
+        FreshCount = 0;
+    }
+    Publish(timestamp);
+}
+
+void mtsATINetFTStatistics::GetStatistics(mtsDoubleMat & result) const
+{
+    // consistent copy of the last published data
+    Snapshot snapshot;
+    for (;;) {
+        const uint32_t before = Sequence.load(std::memory_order_acquire);
+        if (!(before & 1)) {
+            snapshot = Published;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Sequence.load(std::memory_order_relaxed) == before) {
+                break;
+            }
+        }
+    }
+
+    result.SetSize(NUMBER_OF_ROWS, 6);
+    result.SetTimestamp(snapshot.Timestamp);
+    if (snapshot.Count == 0) {
+        result.SetAll(0.0);
+        result.SetValid(false);
+        return;
+    }
+    const double n = static_cast<double>(snapshot.Count);
+    for (size_t axis = 0; axis < 6; ++axis) {
+        const double mean = snapshot.Sum[axis] / n;
+        double variance = snapshot.SumOfSquares[axis] / n - mean * mean;
+        if (variance < 0.0) {
+            variance = 0.0;
+        }
+        result.Element(MEAN, axis) = snapshot.Offset[axis] + mean;
+        result.Element(STANDARD_DEVIATION, axis) = std::sqrt(variance);
+        result.Element(MINIMUM, axis) = snapshot.Minimum[axis];
+        result.Element(MAXIMUM, axis) = snapshot.Maximum[axis];
+        result.Element(PEAK_TO_PEAK, axis) = snapshot.Maximum[axis] - snapshot.Minimum[axis];
+    }
+    result.SetValid(true);
+}
@@ -0,0 +1,135 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cmath>
+
+#include <sawATIForceSensor/mtsATINetFTSynchronizer.h>
+
+mtsATINetFTSynchronizer::mtsATINetFTSynchronizer(void):
+    FrameMode(INTERPOLATE),
+    HistorySize(0)
+{
+}
+
+void mtsATINetFTSynchronizer::Resize(const size_t numberOfSensors, const size_t historySize)
+{
+    HistorySize = (historySize > 1) ? historySize : 2;
+    History.assign(numberOfSensors, std::vector<Sample>(HistorySize));
+    Counts.assign(numberOfSensors, 0);
+}
+
+bool mtsATINetFTSynchronizer::ModeFromString(const std::string & name, Mode & mode)
+{
+    if (name == "nearest") {
+        mode = NEAREST;
+        return true;
+    }
+    if (name == "interpolate") {
+        mode = INTERPOLATE;
+        return true;
+    }
+    return false;
+}
+
+void mtsATINetFTSynchronizer::Add(const size_t sensor, const double time,
+                                  const double * forceTorque, const bool valid)
+{
+    Sample & sample = History[sensor][Counts[sensor] % HistorySize];
+    sample.Time = time;
+    for (size_t i = 0; i < 6; ++i) {
+        sample.ForceTorque[i] = forceTorque[i];
+    }
+    sample.Valid = valid;
+    ++(Counts[sensor]);
+}
+
+double mtsATINetFTSynchronizer::GetLatestTime(const size_t sensor) const
+{
+    if (Counts[sensor] == 0) {
+        return 0.0;
+    }
+    return History[sensor][(Counts[sensor] - 1) % HistorySize].Time;
+}
+
+bool mtsATINetFTSynchronizer::MatchSensor(const size_t sensor, const double time, const double maxAge,
+                                          double * forceTorque, double & distance) const
+{
+    const std::vector<Sample> & history = History[sensor];
+    const size_t count = Counts[sensor];
+    const size_t available = (count < HistorySize) ? count : HistorySize;
+
+    // walk back from the newest sample to find the samples around time
+    const Sample * before = 0;
+    const Sample * after = 0;
+    for (size_t i = 1; i <= available; ++i) {
+        const Sample & sample = history[(count - i) % HistorySize];
+        if (sample.Time <= time) {
+            before = &sample;
+            break;
+        }
+        after = &sample;
+    }
+
+    const Sample * nearest = before;
+    if (!nearest || (after && (after->Time - time < time - before->Time))) {
+        nearest = after;
+    }
+    if (!nearest) {
+        distance = maxAge;
+        return false;
+    }
+    distance = std::fabs(nearest->Time - time);
+    if (!nearest->Valid || (distance > maxAge)) {
+        return false;
+    }
+
+    if ((FrameMode == INTERPOLATE) && before && after
+        && before->Valid && after->Valid && (after->Time > before->Time)) {
+        const double ratio = (time - before->Time) / (after->Time - before->Time);
+        for (size_t i = 0; i < 6; ++i) {
+            forceTorque[i] = before->ForceTorque[i]
+                + ratio * (after->ForceTorque[i] - before->ForceTorque[i]);
+        }
+    } else {
+        for (size_t i = 0; i < 6; ++i) {
+            forceTorque[i] = nearest->ForceTorque[i];
+        }
+    }
+    return true;
+}
+
+bool mtsATINetFTSynchronizer::Match(const double time, const double maxAge,
+                                    double * forceTorque, double & skew) const
+{
+    bool valid = true;
+    skew = 0.0;
+    for (size_t sensor = 0; sensor < History.size(); ++sensor) {
+        double * values = forceTorque + 6 * sensor;
+        double distance;
+        if (!MatchSensor(sensor, time, maxAge, values, distance)) {
+            valid = false;
+            for (size_t i = 0; i < 6; ++i) {
+                values[i] = 0.0;
+            }
+        }
+        if (distance > skew) {
+            skew = distance;
+        }
+    }
+    return valid;
+}
@@ -0,0 +1,109 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <sstream>
+
+#include <cisstCommon/cmnLogger.h>
+#include <cisstCommon/cmnPortability.h>
+#include <sawATIForceSensor/mtsATINetFTThread.h>
+
+#if (CISST_OS == CISST_LINUX)
+#include <alloca.h>
+#include <errno.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+#endif
+
+void mtsATINetFTConfigureCurrentThread(const std::string & name,
+                                       const int cpu,
+                                       const int priority,
+                                       const bool lockMemory,
+                                       const size_t prefaultStackSize)
+{
+    if ((cpu < 0) && (priority == 0) && !lockMemory) {
+        return;
+    }
+#if (CISST_OS == CISST_LINUX)
+    std::stringstream report;
+    const std::string privilegesHint =
+        " (missing privileges? see CAP_SYS_NICE/CAP_IPC_LOCK or rtprio/memlock in /etc/security/limits.conf)";
+    pthread_t self = pthread_self();
+
+    if (cpu >= 0) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+        const int result = pthread_setaffinity_np(self, sizeof(cpu_set_t), &cpuSet);
+        if (result == 0) {
+            report << " CPU affinity: " << cpu;
+        } else {
+            report << " CPU affinity: FAILED";
+            CMN_LOG_INIT_WARNING << "mtsATINetFTConfigureCurrentThread: failed to set affinity of \""
+                                 << name << "\" to CPU " << cpu << ", " << strerror(result) << std::endl;
+        }
+    }
+
+    if (priority > 0) {
+        struct sched_param parameters;
+        memset(&parameters, 0, sizeof(parameters));
+        parameters.sched_priority = priority;
+        const int result = pthread_setschedparam(self, SCHED_FIFO, &parameters);
+        if (result == 0) {
+            report << " SCHED_FIFO priority: " << priority;
+        } else {
+            report << " SCHED_FIFO priority: FAILED";
+            CMN_LOG_INIT_WARNING << "mtsATINetFTConfigureCurrentThread: failed to set SCHED_FIFO priority of \""
+                                 << name << "\" to " << priority << ", " << strerror(result)
+                                 << ((result == EPERM) ? privilegesHint : "") << std::endl;
+        }
+    }
+
+    if (lockMemory) {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) == 0) {
+            // don't give memory back to the system, it would have to be faulted again
+            mallopt(M_TRIM_THRESHOLD, -1);
+            mallopt(M_MMAP_MAX, 0);
+            report << " memory locked";
+        } else {
+            const int error = errno;
+            report << " memory lock: FAILED";
+            CMN_LOG_INIT_WARNING << "mtsATINetFTConfigureCurrentThread: mlockall failed for \""
+                                 << name << "\", " << strerror(error)
+                                 << (((error == EPERM) || (error == ENOMEM)) ? privilegesHint : "")
+                                 << std::endl;
+        }
+        // touch the stack so pages are mapped before the first sample
+        if (prefaultStackSize > 0) {
+            volatile char * stack = static_cast<volatile char *>(alloca(prefaultStackSize));
+            for (size_t i = 0; i < prefaultStackSize; i += 4096) {
+                stack[i] = 0;
+            }
+            report << ", " << prefaultStackSize / 1024 << " KiB stack pre-faulted";
+        }
+    }
+
+    CMN_LOG_INIT_WARNING << "mtsATINetFTConfigureCurrentThread: thread settings for \""
+                         << name << "\":" << report.str() << std::endl;
+#else
+    CMN_LOG_INIT_WARNING << "mtsATINetFTConfigureCurrentThread: CPU affinity, real-time priority and memory locking for \""
+                         << name << "\" are only supported on Linux" << std::endl;
+#endif
+}
@@ -0,0 +1,103 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <sawATIForceSensor/mtsATINetFTToolTransform.h>
+
+mtsATINetFTToolTransform::mtsATINetFTToolTransform(void)
+{
+    Sequence.store(0, std::memory_order_relaxed);
+    NotIdentity.store(false, std::memory_order_relaxed);
+    Set(vctFrm3::Identity());
+    NotIdentity.store(false, std::memory_order_relaxed);
+}
+
+void mtsATINetFTToolTransform::Set(const vctFrm3 & sensorToTool)
+{
+    // compute outside of the critical section
+    Data data;
+    data.Transform = sensorToTool;
+    const vctMatRot3 & R = sensorToTool.Rotation();
+    const vct3 & p = sensorToTool.Translation();
+    // skew(p)
+    const double skew[3][3] = {{  0.0, -p[2],  p[1]},
+                               { p[2],   0.0, -p[0]},
+                               {-p[1],  p[0],   0.0}};
+    bool identity = true;
+    for (size_t row = 0; row < 3; ++row) {
+        for (size_t column = 0; column < 3; ++column) {
+            // R^T
+            const double rt = R.Element(column, row);
+            data.Adjoint[row][column] = rt;
+            data.Adjoint[row][column + 3] = 0.0;
+            data.Adjoint[row + 3][column + 3] = rt;
+            // -R^T skew(p)
+            double product = 0.0;
+            for (size_t k = 0; k < 3; ++k) {
+                product += R.Element(k, row) * skew[k][column];
+            }
+            data.Adjoint[row + 3][column] = -product;
+            if (rt != ((row == column) ? 1.0 : 0.0)) {
+                identity = false;
+            }
+        }
+        if (p[row] != 0.0) {
+            identity = false;
+        }
+    }
+
+    const uint32_t sequence = Sequence.load(std::memory_order_relaxed);
+    Sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    Current = data;
+    Sequence.store(sequence + 2, std::memory_order_release);
+    NotIdentity.store(!identity, std::memory_order_relaxed);
+}
+
+void mtsATINetFTToolTransform::Read(Data & data) const
+{
+    for (;;) {
+        const uint32_t before = Sequence.load(std::memory_order_acquire);
+        if (!(before & 1)) {
+            data = Current;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Sequence.load(std::memory_order_relaxed) == before) {
+                return;
+            }
+        }
+    }
+}
+
+void mtsATINetFTToolTransform::Get(vctFrm3 & sensorToTool) const
+{
+    Data data;
+    Read(data);
+    sensorToTool = data.Transform;
+}
+
+void mtsATINetFTToolTransform::Apply(const double * sensor, double * tool) const
+{
+    Data data;
+    Read(data);
+    for (size_t row = 0; row < 6; ++row) {
+        double value = 0.0;
+        for (size_t column = 0; column < 6; ++column) {
+            value += data.Adjoint[row][column] * sensor[column];
+        }
+        tool[row] = value;
+    }
+}
@@ -0,0 +1,246 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+
+#include <cisstCommon/cmnLogger.h>
+#include <cisstCommon/cmnPortability.h>
+#include <cisstMultiTask/mtsManagerLocal.h>
+#include <sawATIForceSensor/mtsATINetFTTrace.h>
+
+#if (CISST_OS == CISST_LINUX)
+#include <sys/syscall.h>
+#endif
+#if (CISST_OS != CISST_WINDOWS)
+#include <unistd.h>
+#endif
+
+mtsATINetFTTrace::mtsATINetFTTrace(void):
+    Pending(false),
+    Requested(false),
+    WriterRunning(false)
+{
+}
+
+mtsATINetFTTrace::~mtsATINetFTTrace()
+{
+    Stop();
+    for (size_t i = 0; i < Tracks.size(); ++i) {
+        delete Tracks[i];
+    }
+}
+
+bool mtsATINetFTTrace::Configure(const size_t capacity, const size_t numberOfTracks)
+{
+    if (WriterRunning) {
+        CMN_LOG_INIT_ERROR << "mtsATINetFTTrace::Configure: can't be configured while running" << std::endl;
+        return false;
+    }
+    if ((capacity == 0) || (numberOfTracks == 0)) {
+        CMN_LOG_INIT_ERROR << "mtsATINetFTTrace::Configure: capacity and number of tracks must be positive" << std::endl;
+        return false;
+    }
+    for (size_t i = 0; i < Tracks.size(); ++i) {
+        delete Tracks[i];
+    }
+    Tracks.resize(numberOfTracks);
+    for (size_t i = 0; i < numberOfTracks; ++i) {
+        Tracks[i] = new Track;
+        Tracks[i]->Events.resize(capacity);
+        Tracks[i]->Count = 0;
+        Tracks[i]->ThreadId = static_cast<long>(i + 1);
+        // allocated now so Save doesn't allocate
+        Tracks[i]->Snapshot.reserve(capacity);
+    }
+    return true;
+}
+
+void mtsATINetFTTrace::SetTrackName(const size_t track, const std::string & name)
+{
+    if (track < Tracks.size()) {
+        Tracks[track]->Name = name;
+    }
+}
+
+void mtsATINetFTTrace::SetTrackThread(const size_t track)
+{
+    if (track >= Tracks.size()) {
+        return;
+    }
+#if (CISST_OS == CISST_LINUX)
+    Tracks[track]->ThreadId = static_cast<long>(syscall(SYS_gettid));
+#endif
+}
+
+bool mtsATINetFTTrace::Start(void)
+{
+    if (!IsConfigured()) {
+        CMN_LOG_INIT_ERROR << "mtsATINetFTTrace::Start: not configured" << std::endl;
+        return false;
+    }
+    if (WriterRunning) {
+        return true;
+    }
+    WriterRunning = true;
+    WriterThread.Create<mtsATINetFTTrace, int>(this, &mtsATINetFTTrace::WriterLoop, 0, "ATITrace");
+    return true;
+}
+
+void mtsATINetFTTrace::Stop(void)
+{
+    if (!WriterRunning) {
+        return;
+    }
+    WriterRunning = false;
+    WriterSignal.Raise();
+    WriterThread.Wait();
+}
+
+double mtsATINetFTTrace::GetTime(void)
+{
+    return mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime();
+}
+
+bool mtsATINetFTTrace::Save(const std::string & filename, const std::string & processName)
+{
+    if (!WriterRunning) {
+        return false;
+    }
+    // only one request at a time, the writer owns the file names until
+    // it clears Pending
+    bool expected = false;
+    if (!Pending.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        return false;
+    }
+    FileName = filename;
+    ProcessName = processName;
+    Requested.store(true, std::memory_order_release);
+    WriterSignal.Raise();
+    return true;
+}
+
+void mtsATINetFTTrace::Copy(void)
+{
+    for (size_t i = 0; i < Tracks.size(); ++i) {
+        Track & track = *(Tracks[i]);
+        const size_t capacity = track.Events.size();
+        const size_t before = track.Count.load(std::memory_order_acquire);
+        const size_t first = (before > capacity) ? before - capacity : 0;
+        track.Snapshot.resize(before - first);
+        for (size_t index = first; index < before; ++index) {
+            track.Snapshot[index - first] = track.Events[index % capacity];
+        }
+        // the writer might have overwritten the oldest events during the copy,
+        // including the slot of the event it is recording now
+        const size_t after = track.Count.load(std::memory_order_acquire);
+        const size_t overwritten = (after + 1 > capacity) ? after + 1 - capacity : 0;
+        if (overwritten > first) {
+            const size_t dropped = std::min(overwritten - first, track.Snapshot.size());
+            track.Snapshot.erase(track.Snapshot.begin(), track.Snapshot.begin() + dropped);
+        }
+    }
+}
+
+const char * mtsATINetFTTrace::GetStageName(const Stage stage)
+{
+    switch (stage) {
+    case RECEIVE_WAIT:
+        return "receive-wait";
+    case RECEIVE_TIMEOUT:
+        return "receive-timeout";
+    case DECODE:
+        return "decode";
+    case QUEUE_WAIT:
+        return "queue-wait";
+    case COMMANDS:
+        return "commands";
+    case PROCESS_SAMPLE:
+        return "process-sample";
+    case COMMIT:
+        return "state-table-commit";
+    default:
+        break;
+    }
+    return "unknown";
+}
+
+void * mtsATINetFTTrace::WriterLoop(int)
+{
+    bool running = true;
+    while (running) {
+        WriterSignal.Wait(0.1);
+        // one last pass after Stop
+        running = WriterRunning;
+        if (Requested.load(std::memory_order_acquire)) {
+            Requested.store(false, std::memory_order_relaxed);
+            Copy();
+            Write();
+            Pending.store(false, std::memory_order_release);
+        }
+    }
+    return 0;
+}
+
+void mtsATINetFTTrace::Write(void)
+{
+    if (FileName.empty()) {
+        char date[32];
+        const std::time_t now = std::time(0);
+        std::strftime(date, sizeof(date), "%Y%m%d-%H%M%S", std::localtime(&now));
+        FileName = ProcessName + "-trace-" + date + ".json";
+    }
+    std::ofstream file(FileName.c_str());
+    if (!file.good()) {
+        CMN_LOG_RUN_ERROR << "mtsATINetFTTrace::Write: failed to open " << FileName << std::endl;
+        return;
+    }
+#if (CISST_OS != CISST_WINDOWS)
+    const long processId = static_cast<long>(getpid());
+#else
+    const long processId = 1;
+#endif
+    // metadata events name the process and threads, then one complete
+    // event ("X") per stage, times in microseconds
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+         << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << processId
+         << ",\"args\":{\"name\":\"" << ProcessName << "\"}}";
+    size_t numberOfEvents = 0;
+    file << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < Tracks.size(); ++i) {
+        const Track & track = *(Tracks[i]);
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << processId
+             << ",\"tid\":" << track.ThreadId << ",\"args\":{\"name\":\"" << track.Name << "\"}}";
+        for (size_t index = 0; index < track.Snapshot.size(); ++index) {
+            const Event & event = track.Snapshot[index];
+            file << ",\n{\"name\":\"" << GetStageName(static_cast<Stage>(event.Stage))
+                 << "\",\"cat\":\"ATINetFT\",\"ph\":\"X\",\"pid\":" << processId
+                 << ",\"tid\":" << track.ThreadId
+                 << ",\"ts\":" << event.Begin * 1.0e6
+                 << ",\"dur\":" << (event.End - event.Begin) * 1.0e6
+                 << ",\"args\":{\"sequence\":" << event.Sequence << "}}";
+        }
+        numberOfEvents += track.Snapshot.size();
+    }
+    file << "\n]}\n";
+    file.close();
+    CMN_LOG_RUN_VERBOSE << "mtsATINetFTTrace::Write: saved " << numberOfEvents << " events in "
+                        << FileName << std::endl;
+}
@@ -0,0 +1,205 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <fstream>
+
+#include <cisstCommon/cmnLogger.h>
+#include <cisstCommon/cmnUnits.h>
+#include <cisstOSAbstraction/osaSleep.h>
+#include <cisstMultiTask/mtsManagerLocal.h>
+#include <sawATIForceSensor/mtsATINetFTTransport.h>
+
+double mtsATINetFTTransport::GetTime(void)
+{
+    return mtsManagerLocal::GetInstance()->GetTimeServer().GetRelativeTime();
+}
+
+mtsATINetFTTransportReplay::mtsATINetFTTransportReplay(void):
+    Loop(false),
+    Speed(1.0),
+    Next(0),
+    Started(false),
+    StartTime(0.0)
+{
+}
+
+bool mtsATINetFTTransportReplay::Open(std::string & errorMessage)
+{
+    std::ifstream file(FileName.c_str());
+    if (!file.is_open()) {
+        errorMessage = "can't open replay file \"" + FileName + "\"";
+        return false;
+    }
+    Samples.clear();
+    // see mtsATINetFTCapture::Save, comments and column names are skipped
+    std::string line;
+    bool hasRdtSequence = false;
+    std::vector<unsigned long long> indices;
+    while (std::getline(file, line)) {
+        Sample sample;
+        unsigned long long index;
+        unsigned int rdtSequence, ftSequence, status, flags;
+        if (sscanf(line.c_str(), "%llu,%lf,%u,%u,%u,%u,%lf,%lf,%lf,%lf,%lf,%lf",
+                   &index, &sample.Time, &rdtSequence, &ftSequence, &status, &flags,
+                   &sample.ForceTorque[0], &sample.ForceTorque[1], &sample.ForceTorque[2],
+                   &sample.ForceTorque[3], &sample.ForceTorque[4], &sample.ForceTorque[5]) != 12) {
+            continue;
+        }
+        sample.Sequence = rdtSequence;
+        sample.Flags = flags;
+        hasRdtSequence = hasRdtSequence || (rdtSequence != 0);
+        Samples.push_back(sample);
+        indices.push_back(index);
+    }
+    if (Samples.empty()) {
+        errorMessage = "no samples found in replay file \"" + FileName + "\"";
+        return false;
+    }
+    // custom protocol captures don't have RDT sequence numbers
+    if (!hasRdtSequence) {
+        for (size_t i = 0; i < Samples.size(); ++i) {
+            Samples[i].Sequence = static_cast<uint32_t>(indices[i]);
+        }
+    }
+    Next = 0;
+    Started = false;
+    CMN_LOG_INIT_VERBOSE << "mtsATINetFTTransportReplay::Open: loaded " << Samples.size()
+                         << " samples from " << FileName << std::endl;
+    return true;
+}
+
+void mtsATINetFTTransportReplay::Close(void)
+{
+    Samples.clear();
+}
+
+int mtsATINetFTTransportReplay::ReceiveDatagram(const char * & datagram, const double timeout)
+{
+    if (Samples.empty() || (!Loop && (Next >= Samples.size()))) {
+        osaSleep(timeout);
+        return 0;
+    }
+    const double now = GetTime();
+    if (!Started) {
+        Started = true;
+        StartTime = now;
+    }
+    const double first = Samples.front().Time;
+    if (Next >= Samples.size()) {
+        // next pass starts one average period after the last sample
+        const double duration = Samples.back().Time - first;
+        const double period = (Samples.size() > 1) ? duration / (Samples.size() - 1) : 1.0 * cmn_ms;
+        StartTime += (duration + period) / Speed;
+        Next = 0;
+    }
+    const Sample & sample = Samples[Next];
+    const double due = StartTime + (sample.Time - first) / Speed;
+    if (due - now > timeout) {
+        osaSleep(timeout);
+        return 0;
+    }
+    if (due > now) {
+        osaSleep(due - now);
+    }
+    ++Next;
+    datagram = Buffer;
+    return static_cast<int>(mtsATINetFTProtocolCustomVersioned::Encode(sample.Sequence, sample.Flags,
+                                                                       sample.ForceTorque, Buffer));
+}
+
+mtsATINetFTInjectionQueue::mtsATINetFTInjectionQueue(const size_t queueSize):
+    Queue(queueSize)
+{
+}
+
+bool mtsATINetFTInjectionQueue::Inject(const char * buffer, const size_t size)
+{
+    if (size > MAX_SIZE) {
+        return false;
+    }
+    Datagram datagram;
+    datagram.Size = size;
+    memcpy(datagram.Data, buffer, size);
+    if (!Queue.Push(datagram)) {
+        return false;
+    }
+    Signal.Raise();
+    return true;
+}
+
+bool mtsATINetFTInjectionQueue::Pop(Datagram & datagram, const double timeout)
+{
+    if (Queue.Pop(datagram)) {
+        return true;
+    }
+    Signal.Wait(timeout);
+    return Queue.Pop(datagram);
+}
+
+#if (CISST_OS != CISST_WINDOWS)
+mtsATINetFTTransportSharedMemory::mtsATINetFTTransportSharedMemory(void):
+    PollPeriod(100.0e-6),
+    NextIndex(0),
+    NumberOfLostSamples(0)
+{
+}
+
+bool mtsATINetFTTransportSharedMemory::Open(std::string & errorMessage)
+{
+    if (!Reader.Open(Name, errorMessage)) {
+        return false;
+    }
+    NextIndex = Reader.GetWriteCount();
+    NumberOfLostSamples = 0;
+    return true;
+}
+
+void mtsATINetFTTransportSharedMemory::Close(void)
+{
+    Reader.Close();
+}
+
+int mtsATINetFTTransportSharedMemory::ReceiveDatagram(const char * & datagram, const double timeout)
+{
+    if (!Reader.IsOpen()) {
+        osaSleep(timeout);
+        return 0;
+    }
+    const double deadline = GetTime() + timeout;
+    mtsATINetFTSharedMemorySample sample;
+    for (;;) {
+        uint64_t lost = 0;
+        const size_t count = Reader.GetSince(NextIndex, &sample, 1, lost);
+        NumberOfLostSamples += lost;
+        if (count == 1) {
+            datagram = Buffer;
+            return static_cast<int>(mtsATINetFTProtocolCustomVersioned::Encode(static_cast<uint32_t>(sample.Index),
+                                                                               sample.Flags, sample.ForceTorque,
+                                                                               Buffer));
+        }
+        const double now = GetTime();
+        if (now >= deadline) {
+            return 0;
+        }
+        osaSleep(std::min(PollPeriod, deadline - now));
+    }
+}
+#endif
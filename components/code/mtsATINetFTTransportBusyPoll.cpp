@@ -0,0 +1,153 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <errno.h>
+#include <poll.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+#include <cisstCommon/cmnLogger.h>
+#include <sawATIForceSensor/mtsATINetFTTransportBusyPoll.h>
+
+namespace {
+    // hint for the core (and its hyperthread sibling) that we're spinning
+    inline void CPURelax(void)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#elif defined(__aarch64__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+}
+
+mtsATINetFTTransportBusyPoll::mtsATINetFTTransportBusyPoll(osaSocket & socket,
+                                                           const double spinTime,
+                                                           const double yieldTime,
+                                                           const int socketBusyPoll):
+    Socket(socket),
+    SpinTime(spinTime),
+    YieldTime(yieldTime),
+    SocketBusyPoll(socketBusyPoll),
+    ReceivedTime(0),
+    SpinningTime(0),
+    YieldingTime(0),
+    ProductiveTime(0),
+    NumberOfPackets(0)
+{
+}
+
+bool mtsATINetFTTransportBusyPoll::Open(std::string & /*errorMessage*/)
+{
+    SpinningTime = 0;
+    YieldingTime = 0;
+    ProductiveTime = 0;
+    NumberOfPackets = 0;
+    if (SocketBusyPoll > 0) {
+#ifdef SO_BUSY_POLL
+        // not fatal, spinning in user space still works
+        if (setsockopt(Socket.GetIdentifier(), SOL_SOCKET, SO_BUSY_POLL,
+                       &SocketBusyPoll, sizeof(SocketBusyPoll)) != 0) {
+            const int error = errno;
+            CMN_LOG_INIT_WARNING << "mtsATINetFTTransportBusyPoll::Open: failed to set SO_BUSY_POLL to "
+                                 << SocketBusyPoll << " us, " << strerror(error)
+                                 << ((error == EPERM) ? " (requires CAP_NET_ADMIN above net.core.busy_read)" : "")
+                                 << std::endl;
+        }
+#else
+        CMN_LOG_INIT_WARNING << "mtsATINetFTTransportBusyPoll::Open: SO_BUSY_POLL not supported on this platform"
+                             << std::endl;
+#endif
+    }
+    return true;
+}
+
+int mtsATINetFTTransportBusyPoll::ReceiveDatagram(const char * & datagram, const double timeout)
+{
+    const int fd = Socket.GetIdentifier();
+    const unsigned long long start = Now();
+    const unsigned long long spinEnd = start + static_cast<unsigned long long>(SpinTime * 1.0e9);
+    const unsigned long long yieldEnd = spinEnd + static_cast<unsigned long long>(YieldTime * 1.0e9);
+    const unsigned long long deadline = start + static_cast<unsigned long long>(timeout * 1.0e9);
+    unsigned long long phaseStart = start;
+
+    // charge time since phaseStart to the phase it started in, blocked time isn't counted
+    auto charge = [&](const unsigned long long until) {
+        if (phaseStart < spinEnd) {
+            SpinningTime.fetch_add(until - phaseStart, std::memory_order_relaxed);
+        } else if (phaseStart < yieldEnd) {
+            YieldingTime.fetch_add(until - phaseStart, std::memory_order_relaxed);
+        }
+        phaseStart = until;
+    };
+
+    for (;;) {
+        const int size = static_cast<int>(recv(fd, Buffer, sizeof(Buffer), MSG_DONTWAIT));
+        if (size > 0) {
+            // decoding time is charged by ReleaseDatagram
+            ReceivedTime = Now();
+            charge(ReceivedTime);
+            datagram = Buffer;
+            return size;
+        }
+        const int error = (size < 0) ? errno : 0;
+        const unsigned long long now = Now();
+        if ((size < 0) && (error != EAGAIN) && (error != EWOULDBLOCK) && (error != EINTR)) {
+            charge(now);
+            return 0;
+        }
+        if (now >= deadline) {
+            charge(now);
+            return 0;
+        }
+        if (now < spinEnd) {
+            CPURelax();
+        } else if (now < yieldEnd) {
+            if (phaseStart < spinEnd) {
+                charge(now);
+            }
+            sched_yield();
+        } else {
+            // budget exhausted, block until data or timeout
+            charge(now);
+            pollfd descriptor;
+            descriptor.fd = fd;
+            descriptor.events = POLLIN;
+            descriptor.revents = 0;
+            const int milliseconds = static_cast<int>((deadline - now + 999999ULL) / 1000000ULL);
+            if (poll(&descriptor, 1, milliseconds) <= 0) {
+                return 0;
+            }
+            phaseStart = Now();
+        }
+    }
+}
+
+void mtsATINetFTTransportBusyPoll::GetTimes(Times & times) const
+{
+    times.Spinning = SpinningTime.load(std::memory_order_relaxed) * 1.0e-9;
+    times.Yielding = YieldingTime.load(std::memory_order_relaxed) * 1.0e-9;
+    times.Productive = ProductiveTime.load(std::memory_order_relaxed) * 1.0e-9;
+    times.Packets = NumberOfPackets.load(std::memory_order_relaxed);
+}
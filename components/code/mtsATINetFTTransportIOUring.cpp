@@ -0,0 +1,212 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <errno.h>
+#include <string.h>
+#include <liburing.h>
+
+#include <cisstCommon/cmnLogger.h>
+#include <sawATIForceSensor/mtsATINetFTTransportIOUring.h>
+
+namespace {
+    // all buffers share the same group id, one ring per receiver
+    const int BUFFER_GROUP = 0;
+    // larger than all protocols, datagrams with other sizes are ignored
+    const unsigned int BUFFER_SIZE = 128;
+    const unsigned int QUEUE_DEPTH = 8;
+}
+
+mtsATINetFTTransportIOUring::mtsATINetFTTransportIOUring(osaSocket & socket,
+                                                         const unsigned int numberOfBuffers):
+    Socket(socket),
+    Ring(0),
+    BufferRing(0),
+    NumberOfBuffers(2),
+    Armed(false),
+    Current(0),
+    NumberOfRearms(0)
+{
+    // buffer ring size must be a power of 2
+    while (NumberOfBuffers < numberOfBuffers) {
+        NumberOfBuffers *= 2;
+    }
+}
+
+mtsATINetFTTransportIOUring::~mtsATINetFTTransportIOUring()
+{
+    Close();
+}
+
+bool mtsATINetFTTransportIOUring::Open(std::string & errorMessage)
+{
+    // the ring is owned by the thread that created it, so it is
+    // created again in the receiving thread on the first Receive.
+    // this is only to check that the kernel supports all features.
+    if (!Setup(errorMessage)) {
+        return false;
+    }
+    Close();
+    return true;
+}
+
+bool mtsATINetFTTransportIOUring::Setup(std::string & errorMessage)
+{
+    if (Ring) {
+        return true;
+    }
+    Ring = new io_uring;
+    // single thread submits and reaps, completions are only processed
+    // when we wait for them (Linux 6.1), retry without for older kernels
+    int result = io_uring_queue_init(QUEUE_DEPTH, Ring,
+                                     IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_DEFER_TASKRUN);
+    if (result < 0) {
+        result = io_uring_queue_init(QUEUE_DEPTH, Ring, 0);
+    }
+    if (result < 0) {
+        errorMessage = std::string("io_uring_queue_init failed, ") + strerror(-result);
+        delete Ring;
+        Ring = 0;
+        return false;
+    }
+
+    // provided buffers registered with the ring, kernel picks one per datagram
+    BufferRing = io_uring_setup_buf_ring(Ring, NumberOfBuffers, BUFFER_GROUP, 0, &result);
+    if (!BufferRing) {
+        errorMessage = std::string("io_uring_setup_buf_ring failed, ") + strerror(-result);
+        Close();
+        return false;
+    }
+    Buffers.resize(NumberOfBuffers * BUFFER_SIZE);
+    const int mask = io_uring_buf_ring_mask(NumberOfBuffers);
+    for (unsigned int i = 0; i < NumberOfBuffers; ++i) {
+        io_uring_buf_ring_add(BufferRing, &(Buffers[i * BUFFER_SIZE]), BUFFER_SIZE,
+                              static_cast<unsigned short>(i), mask, i);
+    }
+    io_uring_buf_ring_advance(BufferRing, NumberOfBuffers);
+
+    if (!ArmReceive()) {
+        errorMessage = "failed to submit multishot receive";
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void mtsATINetFTTransportIOUring::Close(void)
+{
+    if (!Ring) {
+        return;
+    }
+    if (BufferRing) {
+        io_uring_free_buf_ring(Ring, BufferRing, NumberOfBuffers, BUFFER_GROUP);
+        BufferRing = 0;
+    }
+    // pending multishot receive is cancelled when the ring is released
+    Current = 0;
+    io_uring_queue_exit(Ring);
+    delete Ring;
+    Ring = 0;
+    Armed = false;
+}
+
+bool mtsATINetFTTransportIOUring::ArmReceive(void)
+{
+    io_uring_sqe * sqe = io_uring_get_sqe(Ring);
+    if (!sqe) {
+        return false;
+    }
+    io_uring_prep_recv_multishot(sqe, Socket.GetIdentifier(), 0, 0, 0);
+    sqe->flags |= IOSQE_BUFFER_SELECT;
+    sqe->buf_group = BUFFER_GROUP;
+    if (io_uring_submit(Ring) < 1) {
+        return false;
+    }
+    Armed = true;
+    return true;
+}
+
+void mtsATINetFTTransportIOUring::Recycle(io_uring_cqe * cqe)
+{
+    if (cqe->flags & IORING_CQE_F_BUFFER) {
+        const unsigned short id = static_cast<unsigned short>(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+        io_uring_buf_ring_add(BufferRing, &(Buffers[id * BUFFER_SIZE]), BUFFER_SIZE, id,
+                              io_uring_buf_ring_mask(NumberOfBuffers), 0);
+        io_uring_buf_ring_advance(BufferRing, 1);
+    }
+    // multishot receive stops on errors or when buffers run out
+    if (!(cqe->flags & IORING_CQE_F_MORE)) {
+        Armed = false;
+    }
+    io_uring_cqe_seen(Ring, cqe);
+}
+
+int mtsATINetFTTransportIOUring::ReceiveDatagram(const char * & datagram, const double timeout)
+{
+    if (!Ring) {
+        std::string errorMessage;
+        if (!Setup(errorMessage)) {
+            CMN_LOG_RUN_ERROR << "mtsATINetFTTransportIOUring::ReceiveDatagram: " << errorMessage << std::endl;
+            return 0;
+        }
+    }
+    __kernel_timespec waitTime;
+    waitTime.tv_sec = static_cast<long long>(timeout);
+    waitTime.tv_nsec = static_cast<long long>((timeout - waitTime.tv_sec) * 1.0e9);
+
+    for (;;) {
+        if (!Armed) {
+            ++NumberOfRearms;
+            if (!ArmReceive()) {
+                return 0;
+            }
+        }
+        io_uring_cqe * cqe;
+        // completions already posted don't require a system call
+        if (io_uring_peek_cqe(Ring, &cqe) != 0) {
+            if (io_uring_wait_cqe_timeout(Ring, &cqe, &waitTime) != 0) {
+                return 0;
+            }
+        }
+        const int size = cqe->res;
+        if (size <= 0) {
+            Recycle(cqe);
+            // out of buffers, consumer was too slow, re-arm and keep going
+            if (size == -ENOBUFS) {
+                continue;
+            }
+            if (size < 0) {
+                CMN_LOG_RUN_WARNING << "mtsATINetFTTransportIOUring::ReceiveDatagram: receive failed, "
+                                    << strerror(-size) << std::endl;
+            }
+            return 0;
+        }
+        // decoded in place, buffer is recycled in ReleaseDatagram
+        const unsigned short id = static_cast<unsigned short>(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+        datagram = &(Buffers[id * BUFFER_SIZE]);
+        Current = cqe;
+        return size;
+    }
+}
+
+void mtsATINetFTTransportIOUring::ReleaseDatagram(void)
+{
+    if (Current) {
+        Recycle(Current);
+        Current = 0;
+    }
+}
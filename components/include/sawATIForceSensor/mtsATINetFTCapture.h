@@ -0,0 +1,149 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTCapture_h
+#define _mtsATINetFTCapture_h
+
+#include <atomic>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaThreadSignal.h>
+
+#include <sawATIForceSensor/mtsATINetFTSharedMemory.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Pre/post trigger capture of full rate samples.  Samples are added
+  in the acquisition loop and kept in a ring of PreTrigger +
+  PostTrigger samples.  When a threshold is crossed (rising edge), the
+  capture keeps recording PostTrigger samples in the same ring so it
+  then holds the PreTrigger samples before the trigger and the
+  PostTrigger samples after.  The ring is handed over to a background
+  thread that saves it as a CSV file and the acquisition continues in
+  the next free ring, so Add never blocks nor allocates.  If all rings
+  are waiting to be saved, triggers are ignored and counted as
+  dropped.
+
+  Thresholds are disabled when set to 0: per axis absolute value,
+  force and torque norms and per axis rate of change (per second,
+  computed from consecutive valid samples). */
+class CISST_EXPORT mtsATINetFTCapture
+{
+public:
+    typedef mtsATINetFTSharedMemorySample SampleType;
+
+    mtsATINetFTCapture(void);
+    ~mtsATINetFTCapture();
+
+    /*! Allocate numberOfRings rings.  Files are saved in directory as
+      prefix-<trigger time>-<capture number>.csv.  Must be called
+      before Start. */
+    bool Configure(const size_t preTrigger, const size_t postTrigger,
+                   const std::string & directory, const std::string & prefix,
+                   const size_t numberOfRings = 2);
+
+    void SetAxisThresholds(const double thresholds[6]);
+    void SetForceThreshold(const double threshold);
+    void SetTorqueThreshold(const double threshold);
+    void SetRateThresholds(const double thresholds[6]);
+
+    /*! Start and stop the writer thread.  Stop saves the captures
+      already completed. */
+    bool Start(void);
+    void Stop(void);
+
+    inline bool IsConfigured(void) const {
+        return !Rings.empty();
+    }
+
+    /*! Add a sample, to be called by the acquisition thread.  Returns
+      true if the sample triggered a new capture. */
+    bool Add(const SampleType & sample);
+
+    /*! Trigger a capture on the next sample added, must be called by
+      the acquisition thread (e.g. from a queued command). */
+    void Trigger(void);
+
+    /*! Description of the last trigger, e.g. "Fz" or "|F|". */
+    inline const char * GetLastReason(void) const {
+        return LastReason;
+    }
+    inline size_t GetNumberOfTriggers(void) const {
+        return NumberOfTriggers;
+    }
+    inline size_t GetNumberOfDropped(void) const {
+        return NumberOfDropped;
+    }
+
+protected:
+    enum RingState {
+        RING_FREE = 0,
+        RING_RECORDING,
+        RING_COMPLETE,
+    };
+
+    struct Ring {
+        std::vector<SampleType> Samples;
+        size_t Head;         // next position to write
+        size_t Count;        // number of valid samples, up to capacity
+        size_t Remaining;    // post trigger samples left, 0 until triggered
+        size_t Number;       // capture number, used for file name
+        double TriggerTime;
+        std::time_t TriggerDate;  // wall clock, used for file name
+        const char * Reason;
+        std::atomic<int> State;
+    };
+
+    /*! Returns reason or 0 if no threshold is crossed. */
+    const char * CheckThresholds(const SampleType & sample);
+    Ring * NextFreeRing(void);
+    void * WriterLoop(int);
+    void Save(Ring & ring);
+
+    std::vector<Ring *> Rings;
+    Ring * Current;
+    size_t PreTrigger;
+    size_t PostTrigger;
+    std::string Directory;
+    std::string Prefix;
+
+    double AxisThresholds[6];
+    double ForceThreshold;
+    double TorqueThreshold;
+    double RateThresholds[6];
+
+    // acquisition thread only
+    bool Triggered;          // threshold crossed on previous sample, for edge detection
+    bool ManualTrigger;
+    bool HasPrevious;
+    SampleType Previous;
+    const char * LastReason;
+    size_t NumberOfTriggers;
+    size_t NumberOfDropped;
+
+    // writer thread
+    osaThread WriterThread;
+    osaThreadSignal WriterSignal;
+    std::atomic<bool> WriterRunning;
+};
+
+#endif // _mtsATINetFTCapture_h
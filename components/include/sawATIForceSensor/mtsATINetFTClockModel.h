@@ -0,0 +1,109 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTClockModel_h
+#define _mtsATINetFTClockModel_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Mapping from the sensor's clock (RDT sequence number, one per
+  sample at the sensor's internal rate) to the host clock.  Host
+  receive time = offset + period * sequence is fitted online with an
+  exponentially weighted least squares, older samples are forgotten
+  with the time constant so the period tracks the drift between
+  clocks.  Packets received late (network, scheduler) are not used
+  for the fit.  The time returned is the fitted time, i.e. without
+  jitter, minus the latency (0 by default).
+
+  The model restarts when the sequence goes backward or jumps (new
+  streaming request) or when packets keep arriving far from the
+  line.  Until enough samples are fitted, the receive time is
+  returned as is.  Not thread safe. */
+class CISST_EXPORT mtsATINetFTClockModel
+{
+public:
+    mtsATINetFTClockModel(void);
+
+    /*! timeConstant in seconds, default is 10 s. */
+    void SetTimeConstant(const double timeConstant);
+
+    /*! Constant time between acquisition and reception (seconds)
+      subtracted from the fitted time, default is 0. */
+    inline void SetLatency(const double latency) {
+        Latency = latency;
+    }
+
+    /*! Forget all samples. */
+    void Reset(void);
+
+    /*! Add a sample and return its de-jittered time. */
+    double Update(const uint32_t sequence, const double receiveTime);
+
+    /*! True once the fit is used to compute times. */
+    inline bool IsLocked(void) const {
+        return Locked;
+    }
+
+    /*! Estimated sensor sample period in seconds, 0 if not locked. */
+    double GetPeriod(void) const;
+
+    /*! Root mean square of the residuals used for the fit, in
+      seconds, i.e. jitter removed. */
+    double GetJitter(void) const;
+
+    inline size_t GetNumberOfResets(void) const {
+        return NumberOfResets;
+    }
+
+    /*! Number of packets received too late to be used for the fit. */
+    inline size_t GetNumberOfLatePackets(void) const {
+        return NumberOfLatePackets;
+    }
+
+protected:
+    void Restart(const uint32_t sequence, const double receiveTime);
+    /*! Move the origin to the latest sample to keep the sums small. */
+    void Rebase(void);
+    bool Fit(double & offset, double & slope) const;
+
+    double TimeConstant;
+    double Latency;
+    bool Initialized;
+    bool Locked;
+
+    uint32_t LastSequence;
+    double LastReceiveTime;
+    // sample position and time relative to the origin
+    double X;
+    double TimeOrigin;
+
+    // weighted sums
+    double Sw, Sx, Sy, Sxx, Sxy;
+    double SquaredResiduals;
+    size_t NumberOfSamples;
+    size_t ConsecutiveOutliers;
+
+    size_t NumberOfResets;
+    size_t NumberOfLatePackets;
+};
+
+#endif // _mtsATINetFTClockModel_h
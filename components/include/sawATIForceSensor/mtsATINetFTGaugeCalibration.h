@@ -0,0 +1,79 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTGaugeCalibration_h
+#define _mtsATINetFTGaugeCalibration_h
+
+#include <stddef.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+class mtsATINetFTConfig;
+
+/*! Conversion from raw gauge values to force/torque:
+
+  ft = diag(1/CountsPerForce x 3, 1/CountsPerTorque x 3) * Matrix * (gauges - offsets)
+
+  The scaled matrix is precomputed once and stored transposed in a
+  fixed size, aligned array so Apply is a short loop over contiguous
+  columns the compiler can unroll and vectorize, without allocation
+  nor branches. */
+class CISST_EXPORT mtsATINetFTGaugeCalibration
+{
+public:
+    mtsATINetFTGaugeCalibration(void);
+
+    /*! Precompute from the calibration file loaded in config.  Returns
+      false if the matrix is not 6x6 or counts per unit are not
+      positive. */
+    bool Set(const mtsATINetFTConfig & config);
+
+    /*! Precompute from a row major 6x6 matrix, gauge offsets and
+      counts per force/torque unit. */
+    bool Set(const double matrix[36], const double offsets[6],
+             const double countsPerForce, const double countsPerTorque);
+
+    /*! Replace the gauge offsets, e.g. measured on the rig. */
+    void SetOffsets(const double offsets[6]);
+
+    inline const double * GetOffsets(void) const {
+        return Offsets;
+    }
+
+    /*! Convert 6 gauge values to force/torque. */
+    inline void Apply(const double * gauges, double * forceTorque) const {
+        double result[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+        for (size_t column = 0; column < 6; ++column) {
+            const double gauge = gauges[column] - Offsets[column];
+            const double * matrixColumn = Transposed[column];
+            for (size_t row = 0; row < 6; ++row) {
+                result[row] += matrixColumn[row] * gauge;
+            }
+        }
+        for (size_t row = 0; row < 6; ++row) {
+            forceTorque[row] = result[row];
+        }
+    }
+
+protected:
+    alignas(32) double Transposed[6][6];
+    alignas(32) double Offsets[6];
+};
+
+#endif // _mtsATINetFTGaugeCalibration_h
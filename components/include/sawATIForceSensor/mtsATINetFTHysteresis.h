@@ -0,0 +1,90 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTHysteresis_h
+#define _mtsATINetFTHysteresis_h
+
+/*! Threshold with hysteresis used for contact and overload detection.
+  Becomes active when the value goes above On and inactive when it
+  goes below Off (Off <= On).  Disabled when On is 0 or less. */
+class mtsATINetFTHysteresis
+{
+public:
+    enum Transition {
+        NONE = 0,
+        ACTIVATED,
+        DEACTIVATED
+    };
+
+    inline mtsATINetFTHysteresis(void):
+        On(0.0),
+        Off(0.0),
+        Active(false)
+    {}
+
+    inline bool SetThresholds(const double on, const double off) {
+        if (off > on) {
+            return false;
+        }
+        On = on;
+        Off = off;
+        Active = false;
+        return true;
+    }
+
+    inline bool IsEnabled(void) const {
+        return On > 0.0;
+    }
+
+    inline bool IsActive(void) const {
+        return Active;
+    }
+
+    inline Transition Update(const double value) {
+        if (!Active && (value > On)) {
+            Active = true;
+            return ACTIVATED;
+        }
+        if (Active && (value < Off)) {
+            Active = false;
+            return DEACTIVATED;
+        }
+        return NONE;
+    }
+
+    /*! Back to inactive without transition, e.g. when the sensor is
+      disconnected. */
+    inline void Reset(void) {
+        Active = false;
+    }
+
+    inline double GetOn(void) const {
+        return On;
+    }
+
+    inline double GetOff(void) const {
+        return Off;
+    }
+
+protected:
+    double On;
+    double Off;
+    bool Active;
+};
+
+#endif // _mtsATINetFTHysteresis_h
@@ -0,0 +1,112 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTLatestSample_h
+#define _mtsATINetFTLatestSample_h
+
+#include <sawATIForceSensor/mtsATINetFTSharedMemory.h>
+
+/*! Latest sample for real-time threads in the same process as the
+  sensor component.  Read doesn't lock, allocate nor go through the
+  cisstMultiTask command queues.  Samples are written in a small ring
+  of slots, each with its own sequence lock, so a reader only retries
+  if it was preempted while the writer went around the whole ring.
+  Retries are bounded (MAXIMUM_RETRIES) so Read always completes in a
+  bounded number of steps, it returns false if it couldn't get a
+  consistent copy.
+
+  \code
+  const mtsATINetFTLatestSample & latest = forceSensor->GetLatestSample();
+  mtsATINetFTSharedMemorySample sample;
+  if (latest.Read(sample) && (sample.Flags & ATI_NETFT_SHM_VALID)) {
+      // use sample.ForceTorque, sample.Timestamp, sample.Index
+  }
+  \endcode */
+class mtsATINetFTLatestSample
+{
+public:
+    typedef mtsATINetFTSharedMemorySample SampleType;
+
+    enum {MAXIMUM_RETRIES = 64};
+
+    inline mtsATINetFTLatestSample(void):
+        Count(0)
+    {
+        for (size_t i = 0; i < NUMBER_OF_SLOTS; ++i) {
+            Slots[i].Sequence.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /*! Single writer, called by the sensor component for each sample.
+      Index is set by this method. */
+    inline void Write(const SampleType & sample) {
+        const uint64_t count = Count.load(std::memory_order_relaxed);
+        Slot & slot = Slots[count % NUMBER_OF_SLOTS];
+        const uint32_t sequence = slot.Sequence.load(std::memory_order_relaxed);
+        slot.Sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.Data = sample;
+        slot.Data.Index = count;
+        slot.Sequence.store(sequence + 2, std::memory_order_release);
+        Count.store(count + 1, std::memory_order_release);
+    }
+
+    /*! Copy latest sample, returns false if no sample has been
+      received yet or if the writer kept overwriting the slot being
+      read for MAXIMUM_RETRIES attempts. */
+    inline bool Read(SampleType & sample) const {
+        for (size_t retry = 0; retry < MAXIMUM_RETRIES; ++retry) {
+            const uint64_t count = Count.load(std::memory_order_acquire);
+            if (count == 0) {
+                return false;
+            }
+            const Slot & slot = Slots[(count - 1) % NUMBER_OF_SLOTS];
+            const uint32_t before = slot.Sequence.load(std::memory_order_acquire);
+            if (!(before & 1)) {
+                sample = slot.Data;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if ((slot.Sequence.load(std::memory_order_relaxed) == before)
+                    && (sample.Index == (count - 1))) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /*! Number of samples written so far, can be used to detect new
+      samples without copying. */
+    inline uint64_t GetCount(void) const {
+        return Count.load(std::memory_order_acquire);
+    }
+
+private:
+    // not copyable, readers keep a reference to the sensor's instance
+    mtsATINetFTLatestSample(const mtsATINetFTLatestSample &);
+    mtsATINetFTLatestSample & operator = (const mtsATINetFTLatestSample &);
+
+    enum {NUMBER_OF_SLOTS = 4};
+    struct Slot {
+        std::atomic<uint32_t> Sequence;
+        SampleType Data;
+    };
+    Slot Slots[NUMBER_OF_SLOTS];
+    std::atomic<uint64_t> Count;
+};
+
+#endif // _mtsATINetFTLatestSample_h
@@ -0,0 +1,166 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTMultiSensor_h
+#define _mtsATINetFTMultiSensor_h
+
+#include <vector>
+
+#include <cisstCommon/cmnUnits.h>
+#include <cisstMultiTask/mtsGenericObjectProxy.h>
+#include <cisstMultiTask/mtsTaskContinuous.h>
+#include <cisstMultiTask/mtsVector.h>
+
+#include <sawATIForceSensor/mtsATINetFTSynchronizer.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Acquisition component for several Net F/T sensors (or custom UDP
+  streams) in a single thread, Linux only.  All sockets are
+  registered with one epoll instance, Run waits until any socket is
+  readable and drains all datagrams available without blocking, so a
+  whole cell fits on one (pinned) core instead of one task, thread
+  and blocking socket per sensor.
+
+  Each sensor keeps its own calibration file, status, state table
+  (compact mtsATINetFTRawSample rows, see AddSensor) and
+  provided interface named after the sensor, with the same commands
+  as mtsATINetFTSensor's main interface: measured_cf, GetRawSample,
+  GetRawData, GetPercentOfMax, GetIsConnected, GetIsSaturated,
+  GetHasError, GetPeriodStatistics, Rebias and the ErrorMsg event.
+
+  Sensors are added with AddSensor or from a JSON file (see
+  share/sawATIForceSensor-multi-example.json) before the component
+  is connected.
+
+  Optionally (SetFrames), the component also publishes frames with
+  the force/torque of all sensors at the same time, see the
+  interface "Frames". */
+class CISST_EXPORT mtsATINetFTMultiSensor: public mtsTaskContinuous
+{
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION_ONEARG, CMN_LOG_ALLOW_DEFAULT);
+
+public:
+    mtsATINetFTMultiSensor(const std::string & componentName);
+    mtsATINetFTMultiSensor(const mtsTaskContinuousConstructorArg & arg);
+    ~mtsATINetFTMultiSensor();
+
+    /*! JSON configuration file, requires cisst compiled with JSON
+      support. */
+    void Configure(const std::string & filename);
+    void Startup(void);
+    void Run(void);
+    void Cleanup(void);
+
+    /*! Add a sensor with its own provided interface called name.  For
+      "rdt", ip is the Net F/T box address and port defaults to
+      49152.  For "custom" and "custom-versioned" (see
+      mtsATINetFTProtocol.h), packets are received on port (ip is not
+      used).  calibrationFile is optional (needed for
+      GetPercentOfMax).  historyDepth is the number of samples in the
+      sensor's state table. */
+    bool AddSensor(const std::string & name,
+                   const std::string & ip,
+                   const std::string & protocol = "rdt",
+                   const int port = 0,
+                   const std::string & calibrationFile = "",
+                   const size_t historyDepth = 1000);
+
+    /*! Time without packets after which a sensor is considered
+      disconnected and streaming is requested again, also the
+      longest time Run waits in epoll. */
+    void SetSocketTimeout(const double timeout);
+
+    /*! Same as mtsATINetFTSensor::SetClockModel, applied to all
+      sensors already added.  Frames use these timestamps.  The
+      read command "GetClockModel" of each sensor returns the sample
+      period and jitter removed (RMS), in seconds. */
+    void SetClockModel(const bool enabled, const double timeConstant = 10.0,
+                       const double latency = 0.0);
+
+    /*! Same as mtsATINetFTSensor::SetStallWatchdog, applied to all
+      sensors already added.  Each sensor's interface has the events
+      "Stalled" and "Disconnected" and the read commands
+      "GetIsStalled" and "GetWatchdog".  Deadlines use a timerfd so
+      stalls are detected with sub-millisecond resolution. */
+    void SetStallWatchdog(const double missedIntervals);
+
+    /*! Same as mtsATINetFTSensor::SetCPUAffinity and
+      SetRealTimePriority, applied in Startup. */
+    void SetCPUAffinity(const int cpu);
+    void SetRealTimePriority(const int priority);
+
+    /*! Publish time-aligned frames of all sensors at rate (Hz) in the
+      provided interface "Frames": GetFrame (6 values per sensor, in
+      the order sensors were added), GetFrameTime, GetFrameSkew (see
+      mtsATINetFTSynchronizer::Match), GetSensorNames and
+      GetPeriodStatistics.  Mode is "interpolate" or "nearest".  A
+      frame for time t is built as soon as all connected sensors have
+      a sample after t, or at t + maxWait at the latest.  Must be
+      called after all sensors are added. */
+    bool SetFrames(const double rate,
+                   const std::string & mode = "interpolate",
+                   const double maxWait = 2.0 * cmn_ms,
+                   const size_t historyDepth = 1000);
+
+    inline size_t GetNumberOfSensors(void) const {
+        return Sensors.size();
+    }
+
+protected:
+    void Init(void);
+    bool ConfigureJSON(const std::string & filename);
+
+    class Sensor;
+    void StartStreaming(Sensor * sensor);
+    /*! Read and decode all datagrams available without blocking,
+      see mtsATINetFTProtocol.h. */
+    template <class _protocol>
+    void DrainSensor(Sensor * sensor);
+    void CheckTimeouts(const double now);
+    /*! Arm the timer to wake up epoll_wait after wait seconds. */
+    void ArmTimer(const double wait);
+    /*! Build and publish all frames due. */
+    void ProcessFrames(const double now);
+    void GetSensorNames(mtsStdStringVec & names) const;
+
+    std::vector<Sensor *> Sensors;
+    int EpollFileDescriptor;
+    int TimerFileDescriptor;
+    double SocketTimeout;
+    int ThreadCPU;
+    int ThreadPriority;
+
+    // time-aligned frames
+    mtsATINetFTSynchronizer Synchronizer;
+    mtsStateTable * FrameStateTable;
+    double FramePeriod;
+    double FrameMaxWait;
+    double NextFrameTime;
+    mtsDoubleVec FrameForceTorque;
+    mtsDouble FrameTime;
+    mtsDouble FrameSkew;
+    size_t NumberOfFrames;
+    size_t NumberOfLateFrames;
+    size_t NumberOfSkippedFrames;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION(mtsATINetFTMultiSensor);
+
+#endif // _mtsATINetFTMultiSensor_h
@@ -0,0 +1,162 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTMulticast_h
+#define _mtsATINetFTMulticast_h
+
+// Datagram format used to re-publish samples over UDP multicast.  This
+// file only depends on the standard library so receivers don't need
+// cisst.  All fields are little endian, see README.md for a
+// description usable from other languages.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <sawATIForceSensor/mtsATINetFTSharedMemory.h>
+
+#define ATI_NETFT_MULTICAST_MAGIC "ATIM"
+#define ATI_NETFT_MULTICAST_VERSION 1
+
+enum {
+    ATI_NETFT_MULTICAST_HEADER_SIZE = 16,
+    ATI_NETFT_MULTICAST_SAMPLE_SIZE = 48,
+    // keeps datagrams under a 1500 bytes MTU
+    ATI_NETFT_MULTICAST_MAX_SAMPLES = 30
+};
+
+/*! Datagram header (16 bytes): magic "ATIM", version (uint16),
+  sample size (uint16), datagram sequence number (uint32), number of
+  samples (uint16) and reserved (uint16). */
+struct mtsATINetFTMulticastHeader {
+    uint16_t Version;
+    uint16_t SampleSize;
+    uint32_t Sequence;
+    uint16_t NumberOfSamples;
+};
+
+/*! Little endian encoding independent of the host byte order.
+  Floating point values are encoded using their IEEE 754 bit
+  pattern. */
+inline void mtsATINetFTMulticastPut(char * buffer, const uint64_t value, const size_t size)
+{
+    for (size_t i = 0; i < size; ++i) {
+        buffer[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+inline uint64_t mtsATINetFTMulticastGet(const char * buffer, const size_t size)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; ++i) {
+        value |= static_cast<uint64_t>(static_cast<unsigned char>(buffer[i])) << (8 * i);
+    }
+    return value;
+}
+
+inline void mtsATINetFTMulticastPutDouble(char * buffer, const double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, 8);
+    mtsATINetFTMulticastPut(buffer, bits, 8);
+}
+
+inline double mtsATINetFTMulticastGetDouble(const char * buffer)
+{
+    const uint64_t bits = mtsATINetFTMulticastGet(buffer, 8);
+    double value;
+    memcpy(&value, &bits, 8);
+    return value;
+}
+
+inline void mtsATINetFTMulticastPutFloat(char * buffer, const float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, 4);
+    mtsATINetFTMulticastPut(buffer, bits, 4);
+}
+
+inline float mtsATINetFTMulticastGetFloat(const char * buffer)
+{
+    const uint32_t bits = static_cast<uint32_t>(mtsATINetFTMulticastGet(buffer, 4));
+    float value;
+    memcpy(&value, &bits, 4);
+    return value;
+}
+
+/*! Sample (48 bytes): index (uint64), timestamp (double, sender's
+  time), flags (uint32, ATI_NETFT_SHM_VALID...), RDT sequence
+  (uint32) and force/torque (6 float). */
+inline void mtsATINetFTMulticastEncodeSample(const mtsATINetFTSharedMemorySample & sample,
+                                             char * buffer)
+{
+    mtsATINetFTMulticastPut(buffer, sample.Index, 8);
+    mtsATINetFTMulticastPutDouble(buffer + 8, sample.Timestamp);
+    mtsATINetFTMulticastPut(buffer + 16, sample.Flags, 4);
+    mtsATINetFTMulticastPut(buffer + 20, sample.RdtSequence, 4);
+    for (size_t i = 0; i < 6; ++i) {
+        mtsATINetFTMulticastPutFloat(buffer + 24 + 4 * i, static_cast<float>(sample.ForceTorque[i]));
+    }
+}
+
+inline void mtsATINetFTMulticastDecodeSample(const char * buffer,
+                                             mtsATINetFTSharedMemorySample & sample)
+{
+    sample.Index = mtsATINetFTMulticastGet(buffer, 8);
+    sample.Timestamp = mtsATINetFTMulticastGetDouble(buffer + 8);
+    sample.Flags = static_cast<uint32_t>(mtsATINetFTMulticastGet(buffer + 16, 4));
+    sample.RdtSequence = static_cast<uint32_t>(mtsATINetFTMulticastGet(buffer + 20, 4));
+    sample.FtSequence = 0;
+    sample.Status = 0;
+    for (size_t i = 0; i < 6; ++i) {
+        sample.ForceTorque[i] = mtsATINetFTMulticastGetFloat(buffer + 24 + 4 * i);
+    }
+}
+
+inline void mtsATINetFTMulticastEncodeHeader(const mtsATINetFTMulticastHeader & header,
+                                             char * buffer)
+{
+    memcpy(buffer, ATI_NETFT_MULTICAST_MAGIC, 4);
+    mtsATINetFTMulticastPut(buffer + 4, header.Version, 2);
+    mtsATINetFTMulticastPut(buffer + 6, header.SampleSize, 2);
+    mtsATINetFTMulticastPut(buffer + 8, header.Sequence, 4);
+    mtsATINetFTMulticastPut(buffer + 12, header.NumberOfSamples, 2);
+    mtsATINetFTMulticastPut(buffer + 14, 0, 2);
+}
+
+/*! Returns false if the datagram is not in this format or its size
+  doesn't match the number of samples.  Samples larger than
+  ATI_NETFT_MULTICAST_SAMPLE_SIZE (newer versions) are accepted, only
+  the known fields are decoded. */
+inline bool mtsATINetFTMulticastDecodeHeader(const char * buffer, const size_t size,
+                                             mtsATINetFTMulticastHeader & header)
+{
+    if ((size < ATI_NETFT_MULTICAST_HEADER_SIZE)
+        || (memcmp(buffer, ATI_NETFT_MULTICAST_MAGIC, 4) != 0)) {
+        return false;
+    }
+    header.Version = static_cast<uint16_t>(mtsATINetFTMulticastGet(buffer + 4, 2));
+    header.SampleSize = static_cast<uint16_t>(mtsATINetFTMulticastGet(buffer + 6, 2));
+    header.Sequence = static_cast<uint32_t>(mtsATINetFTMulticastGet(buffer + 8, 4));
+    header.NumberOfSamples = static_cast<uint16_t>(mtsATINetFTMulticastGet(buffer + 12, 2));
+    return (header.SampleSize >= ATI_NETFT_MULTICAST_SAMPLE_SIZE)
+        && (size == ATI_NETFT_MULTICAST_HEADER_SIZE
+            + static_cast<size_t>(header.NumberOfSamples) * header.SampleSize);
+}
+
+#endif // _mtsATINetFTMulticast_h
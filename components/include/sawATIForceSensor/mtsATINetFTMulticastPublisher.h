@@ -0,0 +1,84 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTMulticastPublisher_h
+#define _mtsATINetFTMulticastPublisher_h
+
+#include <string>
+#include <netinet/in.h>
+
+#include <sawATIForceSensor/mtsATINetFTMulticast.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Sends samples to a UDP multicast group, several samples per
+  datagram (see mtsATINetFTMulticast.h).  A datagram is sent when it
+  has SamplesPerDatagram samples or when its first sample is older
+  than MaxDelay.  Sends never block, datagrams are dropped if the
+  socket buffer is full.  Only one thread should call Add and
+  Flush. */
+class CISST_EXPORT mtsATINetFTMulticastPublisher
+{
+public:
+    mtsATINetFTMulticastPublisher(void);
+    ~mtsATINetFTMulticastPublisher();
+
+    /*! group is an IPv4 multicast address (e.g. 239.255.0.1), ttl
+      the number of router hops (1 for the local network) and
+      interfaceAddress the address of the local interface to send
+      from, empty for the default route. */
+    bool Open(const std::string & group, const int port, const int ttl,
+              const std::string & interfaceAddress, std::string & errorMessage);
+    void Close(void);
+
+    inline bool IsOpen(void) const {
+        return (Socket >= 0);
+    }
+
+    /*! samplesPerDatagram is capped to ATI_NETFT_MULTICAST_MAX_SAMPLES,
+      maxDelay is in seconds. */
+    void SetBatch(const size_t samplesPerDatagram, const double maxDelay);
+
+    void Add(const mtsATINetFTSharedMemorySample & sample);
+    /*! Send the pending samples, if any. */
+    void Flush(void);
+
+    inline size_t GetNumberOfDatagrams(void) const {
+        return NumberOfDatagrams;
+    }
+
+    inline size_t GetNumberOfSendErrors(void) const {
+        return NumberOfSendErrors;
+    }
+
+protected:
+    int Socket;
+    sockaddr_in Destination;
+    size_t SamplesPerDatagram;
+    double MaxDelay;
+    size_t Count;
+    double FirstTimestamp;
+    uint32_t Sequence;
+    size_t NumberOfDatagrams;
+    size_t NumberOfSendErrors;
+    char Buffer[ATI_NETFT_MULTICAST_HEADER_SIZE
+                + ATI_NETFT_MULTICAST_MAX_SAMPLES * ATI_NETFT_MULTICAST_SAMPLE_SIZE];
+};
+
+#endif // _mtsATINetFTMulticastPublisher_h
@@ -0,0 +1,136 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTMulticastReceiver_h
+#define _mtsATINetFTMulticastReceiver_h
+
+#include <cisstCommon/cmnUnits.h>
+#include <cisstVector/vctFixedSizeVectorTypes.h>
+#include <cisstMultiTask/mtsTaskContinuous.h>
+#include <cisstMultiTask/mtsVector.h>
+#include <cisstParameterTypes/prmForceCartesianGet.h>
+
+#include <sawATIForceSensor/mtsATINetFTConfig.h>
+#include <sawATIForceSensor/mtsATINetFTMulticast.h>
+#include <sawATIForceSensor/mtsATINetFTRawSample.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Receives samples re-published by mtsATINetFTSensor::SetMulticast
+  and provides the same "ProvidesATINetFTSensor" interface as the
+  sensor component (measured_cf, GetRawSample, GetRawData,
+  GetPercentOfMax, GetIsConnected, GetIsSaturated, GetHasError,
+  GetIsInContact, GetIsOverloaded, GetPeriodStatistics, Rebias and
+  the ErrorMsg event), so existing clients (Qt widget, ROS bridge...)
+  can run on other computers without connecting to the sensor.
+  Samples are already calibrated, the calibration file is only
+  needed for GetPercentOfMax.  Rebias only applies to this
+  receiver: the latest wrench is subtracted from the following
+  samples.  Not supported on Windows. */
+class CISST_EXPORT mtsATINetFTMulticastReceiver: public mtsTaskContinuous
+{
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION_ONEARG, CMN_LOG_ALLOW_DEFAULT);
+
+public:
+    mtsATINetFTMulticastReceiver(const std::string & componentName);
+    mtsATINetFTMulticastReceiver(const mtsTaskContinuousConstructorArg & arg);
+    ~mtsATINetFTMulticastReceiver();
+
+    /*! JSON configuration file, requires cisst compiled with JSON
+      support. */
+    void Configure(const std::string & filename);
+    void Startup(void);
+    void Run(void);
+    void Cleanup(void);
+
+    /*! Multicast group and port used by the publisher,
+      interfaceAddress is the local address to join the group on
+      (empty for default).  Must be called before Startup. */
+    void SetGroup(const std::string & group, const int port,
+                  const std::string & interfaceAddress = "");
+
+    /*! Time without data after which the publisher is considered
+      disconnected. */
+    void SetSocketTimeout(const double timeout);
+
+    /*! ATI calibration file, only used for GetPercentOfMax. */
+    bool LoadCalibrationFile(const std::string & filename);
+
+    /*! By default samples are timestamped when received.  Use the
+      publisher's timestamps only if both computers' clocks are
+      synchronized (e.g. PTP) and share the same time origin. */
+    void SetUseSenderTimestamps(const bool useSenderTimestamps);
+
+protected:
+    void Init(void);
+    bool ConfigureJSON(const std::string & filename);
+    /*! Decode all samples in a datagram, one state table row each. */
+    void ProcessDatagram(const char * buffer, const size_t size, const double receiveTime);
+    void ProcessSample(const mtsATINetFTSharedMemorySample * sample, const double receiveTime);
+    void Rebias(void);
+
+    bool GetLatestRawSample(mtsATINetFTRawSample & sample) const;
+    void GetRawData(mtsDoubleVec & forceTorque) const;
+    void GetMeasuredCF(prmForceCartesianGet & forceTorque) const;
+    void GetPercentOfMax(mtsDoubleVec & percent) const;
+    void GetIsConnected(bool & isConnected) const;
+    void GetIsSaturated(bool & isSaturated) const;
+    void GetHasError(bool & hasError) const;
+    void GetIsInContact(bool & isInContact) const;
+    void GetIsOverloaded(bool & isOverloaded) const;
+
+    std::string Group;
+    int Port;
+    std::string InterfaceAddress;
+    int Socket;
+    double SocketTimeout;
+    bool UseSenderTimestamps;
+    bool IsConnected;
+    double LastReceiveTime;
+
+    mtsATINetFTConfig NetFTConfig;
+    bool IsCalibFileLoaded;
+    vctDouble6 Bias;
+    bool IsRebiasRequested;
+    mtsATINetFTSharedMemorySample LatestSample;
+
+    // datagrams and samples lost, from sequence numbers.  Datagrams
+    // up to REORDER_WINDOW older than the last one are ignored, larger
+    // jumps (either way) mean the publisher restarted.
+    enum {REORDER_WINDOW = 1024};
+    bool HasSequence;
+    uint32_t LastSequence;
+    uint64_t LastIndex;
+    size_t NumberOfDatagrams;
+    size_t NumberOfLostDatagrams;
+    size_t NumberOfLostSamples;
+    size_t NumberOfReorderedDatagrams;
+    size_t NumberOfInvalidDatagrams;
+
+    mtsATINetFTRawSample RawSample;
+    mtsStateTable::Accessor<mtsATINetFTRawSample> * RawSampleAccessor;
+    mtsFunctionWrite ErrorMsg;
+
+    // largest UDP payload, newer versions may use larger samples
+    char Buffer[65536];
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION(mtsATINetFTMulticastReceiver);
+
+#endif // _mtsATINetFTMulticastReceiver_h
@@ -0,0 +1,94 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTOutputChannel_h
+#define _mtsATINetFTOutputChannel_h
+
+#include <cisstVector/vctFixedSizeVectorTypes.h>
+#include <cisstMultiTask/mtsStateTable.h>
+#include <cisstParameterTypes/prmForceCartesianGet.h>
+
+#include <sawATIForceSensor/mtsATINetFTSharedMemory.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Decimated output with its own state table.  Each axis goes through
+  a fourth order Butterworth low pass filter (two biquad sections) at
+  the input rate before decimation.  The cutoff frequency is
+  cutoffRatio times the output Nyquist frequency, with the default 0.5
+  the attenuation at the output Nyquist frequency is about 24 dB.
+  With a decimation of 1, samples are not filtered. */
+class CISST_EXPORT mtsATINetFTOutputChannel
+{
+public:
+    mtsATINetFTOutputChannel(const std::string & name,
+                             const unsigned int decimation,
+                             const double cutoffRatio,
+                             const size_t historyDepth);
+    ~mtsATINetFTOutputChannel();
+
+    /*! Filter new sample, every decimation samples the filtered value
+      is written in the state table. */
+    void Update(const mtsATINetFTSharedMemorySample & sample);
+
+    /*! Reset filter state, next sample is used as initial value. */
+    void Reset(void);
+
+    /*! Change the decimation and cutoff ratio, must be called by the
+      thread calling Update (i.e. at a sample boundary).  The filter
+      restarts from the next sample, used as steady state.  Returns
+      false and leaves the filter unchanged if decimation is 0 or
+      cutoffRatio is not in ]0, 1]. */
+    bool SetFilter(const unsigned int decimation, const double cutoffRatio);
+
+    inline const std::string & GetName(void) const {
+        return Name;
+    }
+    inline unsigned int GetDecimation(void) const {
+        return Decimation;
+    }
+    inline double GetCutoffRatio(void) const {
+        return CutoffRatio;
+    }
+
+    mtsStateTable * StateTable;
+    prmForceCartesianGet ForceTorque;
+
+protected:
+    /*! Biquad coefficients for Decimation and CutoffRatio. */
+    void ComputeCoefficients(void);
+
+    std::string Name;
+    unsigned int Decimation;
+    double CutoffRatio;
+    unsigned int Counter;
+    bool Initialized;
+
+    enum {NUMBER_OF_SECTIONS = 2};
+    // biquad coefficients, normalized with a0 = 1
+    struct Section {
+        double B0, B1, B2, A1, A2;
+        // direct form II transposed states per axis
+        vct6 State1, State2;
+    };
+    Section Sections[NUMBER_OF_SECTIONS];
+    vct6 Output;
+};
+
+#endif // _mtsATINetFTOutputChannel_h
@@ -0,0 +1,220 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTProtocol_h
+#define _mtsATINetFTProtocol_h
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <cisstCommon/cmnPortability.h>
+
+#if (CISST_OS == CISST_WINDOWS)
+#include <Winsock2.h>
+#else
+#include <arpa/inet.h>
+#endif
+
+#include <sawATIForceSensor/mtsATINetFTSharedMemory.h>
+
+/*! Decoded datagram.  Counts are always set, with CountsPerUnit
+  counts per N or Nm (1e6 for RDT, see mtsATINetFTToCounts for the
+  custom protocols).  Values are only set by the custom protocols
+  (force/torque or raw gauges). */
+struct mtsATINetFTPacket {
+    double ReceiveTime;      // host time, same time base as cisstMultiTask
+    uint32_t RdtSequence;    // RDT or versioned custom sequence number
+    uint32_t FtSequence;
+    uint32_t Status;         // RDT status word
+    bool Error;              // from RDT status word or custom protocol bytes
+    bool Saturated;
+    int32_t Counts[6];
+    uint32_t CountsPerUnit;
+    double Values[6];        // custom, force/torque or raw gauges
+};
+
+/*! Protocol decoders.  Each protocol is a class with static members
+  only, used as a template parameter by mtsATINetFTSource so the
+  decoder is inlined in the receive loop of each transport:
+  - GetName(), name used in configuration files
+  - HAS_SEQUENCE, datagrams are numbered by the sender at a fixed
+    rate (required for mtsATINetFTClockModel)
+  - Decode(buffer, size, packet), returns false if the datagram
+    doesn't match the protocol */
+
+/*! Convert force/torque to counts with the finest resolution that
+  fits all axes in an int32: 1e6 counts per unit (same as RDT) up to
+  2147 N or Nm, otherwise the largest power of 10 that fits.  Returns
+  false if values had to be clamped (above 2.1e9 or not a number). */
+inline bool mtsATINetFTToCounts(const double * values, int32_t * counts,
+                                uint32_t & countsPerUnit)
+{
+    const double limit = 2147483647.0;
+    double maximum = 0.0;
+    for (size_t i = 0; i < 6; ++i) {
+        const double magnitude = fabs(values[i]);
+        if (magnitude > maximum) {
+            maximum = magnitude;
+        }
+    }
+    countsPerUnit = 1000000;
+    while ((countsPerUnit > 1) && (maximum * countsPerUnit >= limit)) {
+        countsPerUnit /= 10;
+    }
+    bool inRange = true;
+    for (size_t i = 0; i < 6; ++i) {
+        double value = floor(values[i] * countsPerUnit + 0.5);
+        if (value > limit) {
+            value = limit;
+            inRange = false;
+        } else if (value < -limit) {
+            value = -limit;
+            inRange = false;
+        } else if (value != value) {
+            value = 0.0;
+            inRange = false;
+        }
+        counts[i] = static_cast<int32_t>(value);
+    }
+    return inRange;
+}
+
+/*! Net F/T raw data transfer (RDT), see section 9.1 of the Net F/T
+  user manual.  36 bytes, network byte order. */
+struct mtsATINetFTProtocolRDT {
+    enum {
+        SIZE = 36,
+        HAS_SEQUENCE = 1
+    };
+
+    static inline const char * GetName(void) {
+        return "rdt";
+    }
+
+    static inline bool Decode(const char * buffer, const size_t size, mtsATINetFTPacket & packet) {
+        if (size != SIZE) {
+            return false;
+        }
+        uint32_t word;
+        memcpy(&word, buffer, 4);
+        packet.RdtSequence = ntohl(word);
+        memcpy(&word, buffer + 4, 4);
+        packet.FtSequence = ntohl(word);
+        memcpy(&word, buffer + 8, 4);
+        packet.Status = ntohl(word);
+        for (size_t i = 0; i < 6; ++i) {
+            memcpy(&word, buffer + 12 + i * 4, 4);
+            packet.Counts[i] = static_cast<int32_t>(ntohl(word));
+        }
+        packet.CountsPerUnit = 1000000;
+        // status word checks, same as the original component
+        packet.Saturated = (packet.Status == ntohl(0x00020000));
+        packet.Error = !((packet.Status == ntohl(0x00000000)) || (packet.Status == ntohl(0x80010000)));
+        return true;
+    }
+};
+
+/*! Original custom protocol (e.g. xPC or sawATINetFTSimulatorQtWidget):
+  6 doubles followed by the error and saturation flags as int, host
+  byte order.  No sequence number. */
+struct mtsATINetFTProtocolCustom {
+    enum {
+        SIZE = 6 * sizeof(double) + 2 * sizeof(int),
+        HAS_SEQUENCE = 0
+    };
+
+    static inline const char * GetName(void) {
+        return "custom";
+    }
+
+    static inline bool Decode(const char * buffer, const size_t size, mtsATINetFTPacket & packet) {
+        if (size != SIZE) {
+            return false;
+        }
+        // Force-Torque values followed by error and saturation bytes
+        memcpy(packet.Values, buffer, 6 * sizeof(double));
+        const bool inRange = mtsATINetFTToCounts(packet.Values, packet.Counts, packet.CountsPerUnit);
+        packet.Error = (buffer[48] == 1);
+        packet.Saturated = (buffer[52] == 1) || !inRange;
+        packet.RdtSequence = 0;
+        packet.FtSequence = 0;
+        packet.Status = 0;
+        return true;
+    }
+};
+
+/*! Versioned custom protocol, little endian.  Header (16 bytes):
+  magic "ATIC", version (uint16, 1), header size (uint16), sequence
+  number (uint32) and flags (uint32, ATI_NETFT_SHM_SATURATED and
+  ATI_NETFT_SHM_ERROR), followed by force/torque (6 double) at offset
+  header size.  Larger headers (newer versions) are accepted, only
+  the known fields are decoded.  The sequence number is incremented
+  for each sample so losses are visible and the clock model can be
+  used. */
+struct mtsATINetFTProtocolCustomVersioned {
+    enum {
+        HEADER_SIZE = 16,
+        SIZE = HEADER_SIZE + 6 * sizeof(double),
+        VERSION = 1,
+        HAS_SEQUENCE = 1
+    };
+
+    static inline const char * GetName(void) {
+        return "custom-versioned";
+    }
+
+    static inline bool Decode(const char * buffer, const size_t size, mtsATINetFTPacket & packet) {
+        if ((size < SIZE) || (memcmp(buffer, "ATIC", 4) != 0)) {
+            return false;
+        }
+        uint16_t headerSize;
+        memcpy(&headerSize, buffer + 6, 2);
+        if ((headerSize < HEADER_SIZE) || (size < headerSize + 6 * sizeof(double))) {
+            return false;
+        }
+        uint32_t flags;
+        memcpy(&packet.RdtSequence, buffer + 8, 4);
+        memcpy(&flags, buffer + 12, 4);
+        memcpy(packet.Values, buffer + headerSize, 6 * sizeof(double));
+        const bool inRange = mtsATINetFTToCounts(packet.Values, packet.Counts, packet.CountsPerUnit);
+        packet.Error = (flags & ATI_NETFT_SHM_ERROR);
+        packet.Saturated = (flags & ATI_NETFT_SHM_SATURATED) || !inRange;
+        packet.FtSequence = 0;
+        packet.Status = flags;
+        return true;
+    }
+
+    /*! Encode a datagram in buffer (at least SIZE bytes), returns the
+      size. */
+    static inline size_t Encode(const uint32_t sequence, const uint32_t flags,
+                                const double * forceTorque, char * buffer) {
+        const uint16_t version = VERSION;
+        const uint16_t headerSize = HEADER_SIZE;
+        memcpy(buffer, "ATIC", 4);
+        memcpy(buffer + 4, &version, 2);
+        memcpy(buffer + 6, &headerSize, 2);
+        memcpy(buffer + 8, &sequence, 4);
+        memcpy(buffer + 12, &flags, 4);
+        memcpy(buffer + HEADER_SIZE, forceTorque, 6 * sizeof(double));
+        return SIZE;
+    }
+};
+
+#endif // _mtsATINetFTProtocol_h
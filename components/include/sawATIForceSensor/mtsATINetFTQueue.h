@@ -0,0 +1,94 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTQueue_h
+#define _mtsATINetFTQueue_h
+
+#include <atomic>
+#include <stddef.h>
+#include <vector>
+
+/*! Bounded lock-free queue for one producer thread and one consumer
+  thread.  Elements are copied in preallocated storage, Push and Pop
+  never block nor allocate.  Capacity is rounded up to a power of 2. */
+template <class _elementType>
+class mtsATINetFTQueue
+{
+public:
+    typedef _elementType value_type;
+
+    inline mtsATINetFTQueue(const size_t capacity = 1024):
+        Head(0),
+        Tail(0)
+    {
+        size_t size = 2;
+        while (size < capacity) {
+            size *= 2;
+        }
+        Elements.resize(size);
+        Mask = size - 1;
+    }
+
+    inline size_t GetCapacity(void) const {
+        return Elements.size();
+    }
+
+    /*! Producer only.  Returns false if the queue is full. */
+    inline bool Push(const value_type & element) {
+        const size_t tail = Tail.load(std::memory_order_relaxed);
+        if (tail - Head.load(std::memory_order_acquire) == Elements.size()) {
+            return false;
+        }
+        Elements[tail & Mask] = element;
+        Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*! Consumer only.  Returns false if the queue is empty. */
+    inline bool Pop(value_type & element) {
+        const size_t head = Head.load(std::memory_order_relaxed);
+        if (head == Tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        element = Elements[head & Mask];
+        Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*! Approximate number of elements, exact for the consumer. */
+    inline size_t GetSize(void) const {
+        return Tail.load(std::memory_order_acquire) - Head.load(std::memory_order_acquire);
+    }
+
+    inline bool IsEmpty(void) const {
+        return GetSize() == 0;
+    }
+
+private:
+    std::vector<value_type> Elements;
+    size_t Mask;
+    // padding so producer and consumer don't share a cache line, not
+    // alignas since queues are allocated with new (no over-aligned new before C++17)
+    char Padding0[64];
+    std::atomic<size_t> Head;
+    char Padding1[64 - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> Tail;
+    char Padding2[64 - sizeof(std::atomic<size_t>)];
+};
+
+#endif // _mtsATINetFTQueue_h
@@ -0,0 +1,90 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTRawSample_h
+#define _mtsATINetFTRawSample_h
+
+#include <stdint.h>
+
+#include <cisstMultiTask/mtsGenericObject.h>
+#include <cisstVector/vctFixedSizeVectorTypes.h>
+
+#include <sawATIForceSensor/mtsATINetFTSharedMemory.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Compact sample stored in the sensor's state table: force/torque
+  counts as sent by the Net F/T (1e-6 N or Nm per count), status word
+  and flags (ATI_NETFT_SHM_VALID...).  Doubles, percentage of range
+  and booleans are derived when read.  About 64 bytes per row.
+
+  Protocols sending doubles are converted with a per sample
+  resolution (CountsPerUnit, see mtsATINetFTToCounts) so large values
+  are not clipped. */
+class CISST_EXPORT mtsATINetFTRawSample: public mtsGenericObject
+{
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
+
+public:
+    /*! Resolution of the Net F/T counts, finest resolution used for
+      doubles. */
+    enum {COUNTS_PER_UNIT = 1000000};
+
+    mtsATINetFTRawSample(void);
+    ~mtsATINetFTRawSample() {}
+
+    int32_t Counts[6];
+    uint32_t Status;
+    uint32_t RdtSequence;
+    uint32_t Flags;
+    uint32_t CountsPerUnit;
+
+    /*! Convert from doubles, used for protocols sending doubles.
+      Values are rounded to the count resolution, returns false if
+      they had to be clamped (caller should flag the sample as
+      saturated). */
+    bool SetForceTorque(const double * forceTorque);
+
+    inline void GetForceTorque(double * forceTorque) const {
+        const double countsPerUnit = static_cast<double>(CountsPerUnit);
+        for (size_t i = 0; i < 6; ++i) {
+            forceTorque[i] = static_cast<double>(Counts[i]) / countsPerUnit;
+        }
+    }
+
+    inline vctDouble6 GetForceTorque(void) const {
+        vctDouble6 forceTorque;
+        GetForceTorque(forceTorque.Pointer());
+        return forceTorque;
+    }
+
+    inline bool HasFlag(const uint32_t flag) const {
+        return (Flags & flag) != 0;
+    }
+
+    void ToStream(std::ostream & outputStream) const;
+    void ToStreamRaw(std::ostream & outputStream, const char delimiter = ' ',
+                     bool headerOnly = false, const std::string & headerPrefix = "") const;
+    void SerializeRaw(std::ostream & outputStream) const;
+    void DeSerializeRaw(std::istream & inputStream);
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION(mtsATINetFTRawSample);
+
+#endif // _mtsATINetFTRawSample_h
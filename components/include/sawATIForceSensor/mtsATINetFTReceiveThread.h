@@ -0,0 +1,136 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTReceiveThread_h
+#define _mtsATINetFTReceiveThread_h
+
+#include <atomic>
+
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaThreadSignal.h>
+
+#include <sawATIForceSensor/mtsATINetFTQueue.h>
+#include <sawATIForceSensor/mtsATINetFTReceiver.h>
+#include <sawATIForceSensor/mtsATINetFTTrace.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Dedicated thread that only receives, timestamps and decodes
+  datagrams and pushes them in a lock-free queue consumed by the
+  sensor component.  Queued commands or state table readers in the
+  component's thread don't delay the socket reads anymore.  If the
+  consumer falls behind and the queue is full, new packets are
+  dropped and counted. */
+class CISST_EXPORT mtsATINetFTReceiveThread
+{
+public:
+    mtsATINetFTReceiveThread(const size_t queueSize = 1024);
+    ~mtsATINetFTReceiveThread();
+
+    /*! Start receiving from source, a mtsATINetFTSource.  The receive
+      loop is compiled for the source type, there is no virtual call
+      per datagram.  cpu and priority (SCHED_FIFO) are applied in the
+      thread (see mtsATINetFTConfigureCurrentThread), Linux only, -1
+      and 0 to keep defaults.  timeout is used to check for Stop. */
+    template <class _source>
+    inline bool Start(_source * source, const double timeout,
+                      const int cpu = -1, const int priority = 0) {
+        return StartLoop(source, &mtsATINetFTReceiveThread::ReceiveLoop<_source>,
+                         timeout, cpu, priority);
+    }
+    void Stop(void);
+
+    /*! Record receive wait and decode times in track of trace (see
+      mtsATINetFTTrace), 0 to disable.  Must be called before
+      Start. */
+    inline void SetTrace(mtsATINetFTTrace * trace, const size_t track) {
+        Trace = trace;
+        Track = track;
+    }
+
+    /*! Consumer side. */
+    inline bool Pop(mtsATINetFTPacket & packet) {
+        return Queue.Pop(packet);
+    }
+    inline bool IsEmpty(void) const {
+        return Queue.IsEmpty();
+    }
+    /*! Wait until a packet is pushed, returns false after timeout. */
+    bool Wait(const double timeout);
+
+    inline size_t GetNumberOfPackets(void) const {
+        return NumberOfPackets.load(std::memory_order_relaxed);
+    }
+    inline size_t GetNumberOfDropped(void) const {
+        return NumberOfDropped.load(std::memory_order_relaxed);
+    }
+
+protected:
+    typedef void (mtsATINetFTReceiveThread::*LoopMethod)(void);
+    bool StartLoop(mtsATINetFTReceiver * receiver, const LoopMethod loop,
+                   const double timeout, const int cpu, const int priority);
+    /*! Thread entry point, calls ReceiveLoop for the source type. */
+    void * Loop(int);
+    template <class _source>
+    void ReceiveLoop(void);
+
+    mtsATINetFTQueue<mtsATINetFTPacket> Queue;
+    mtsATINetFTReceiver * Receiver;
+    LoopMethod ReceiveLoopMethod;
+    double Timeout;
+    int CPU;
+    int Priority;
+    mtsATINetFTTrace * Trace;
+    size_t Track;
+
+    osaThread Thread;
+    osaThreadSignal Signal;
+    std::atomic<bool> Running;
+    std::atomic<size_t> NumberOfPackets;
+    std::atomic<size_t> NumberOfDropped;
+};
+
+template <class _source>
+void mtsATINetFTReceiveThread::ReceiveLoop(void)
+{
+    _source * source = static_cast<_source *>(Receiver);
+    mtsATINetFTPacket packet;
+    while (Running) {
+        const double begin = Trace ? mtsATINetFTTrace::GetTime() : 0.0;
+        if (!source->Receive(packet, Timeout)) {
+            if (Trace) {
+                Trace->Record(Track, mtsATINetFTTrace::RECEIVE_TIMEOUT, begin, mtsATINetFTTrace::GetTime());
+            }
+            continue;
+        }
+        if (Trace) {
+            // the transport timestamps the datagram when it is received
+            const double end = mtsATINetFTTrace::GetTime();
+            Trace->Record(Track, mtsATINetFTTrace::RECEIVE_WAIT, begin, packet.ReceiveTime, packet.RdtSequence);
+            Trace->Record(Track, mtsATINetFTTrace::DECODE, packet.ReceiveTime, end, packet.RdtSequence);
+        }
+        NumberOfPackets.fetch_add(1, std::memory_order_relaxed);
+        if (!Queue.Push(packet)) {
+            NumberOfDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        Signal.Raise();
+    }
+}
+
+#endif // _mtsATINetFTReceiveThread_h
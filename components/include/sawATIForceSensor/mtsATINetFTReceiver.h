@@ -0,0 +1,69 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTReceiver_h
+#define _mtsATINetFTReceiver_h
+
+#include <string>
+
+#include <sawATIForceSensor/mtsATINetFTProtocol.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Base of the sources of decoded packets used by the sensor
+  component and mtsATINetFTReceiveThread.  Implemented by
+  mtsATINetFTSource, a transport (UDP socket, replay file, shared
+  memory, test injection, see mtsATINetFTTransport.h) composed with a
+  protocol decoder (see mtsATINetFTProtocol.h) at compile time.  This
+  interface is only used to open, close and report on the source.
+  Receive is not virtual: the receive and process loops are compiled
+  for each source type and the combination is picked once when the
+  source is opened (see mtsATINetFTSensor::SelectReceiveMethod and
+  mtsATINetFTReceiveThread::Start), there is no virtual call per
+  datagram. */
+class CISST_EXPORT mtsATINetFTReceiver
+{
+public:
+    enum Protocol {
+        RDT = 0,
+        CUSTOM,
+        CUSTOM_VERSIONED
+    };
+
+    virtual ~mtsATINetFTReceiver();
+
+    /*! Called once the transport is configured, returns false if it
+      can't be used. */
+    virtual bool Open(std::string & errorMessage) = 0;
+    virtual void Close(void) = 0;
+
+    /*! Transport name, e.g. "osaSocket", "io_uring" or "replay". */
+    virtual const char * GetName(void) const = 0;
+    virtual const char * GetProtocolName(void) const = 0;
+    /*! Protocol numbers samples, see mtsATINetFTClockModel. */
+    virtual bool HasSequence(void) const = 0;
+
+    virtual size_t GetNumberOfInvalidPackets(void) const = 0;
+
+    /*! "rdt", "custom" or "custom-versioned", returns false for other
+      names. */
+    static bool ProtocolFromString(const std::string & name, Protocol & protocol);
+};
+
+#endif // _mtsATINetFTReceiver_h
@@ -19,23 +19,44 @@ http://www.cisst.org/cisst/license.txt.
 #ifndef _mtsATINetFTSensor_h
 #define _mtsATINetFTSensor_h
 
+#include <atomic>
+#include <vector>
+
 #include <cisstCommon/cmnUnits.h>
+#include <cisstVector/vctFixedSizeVectorTypes.h>
 #include <cisstOSAbstraction/osaSocket.h>
 #include <cisstMultiTask/mtsTaskContinuous.h>
 #include <cisstMultiTask/mtsVector.h>
 #include <cisstParameterTypes/prmForceCartesianGet.h>
 
+#include <sawATIForceSensor/mtsATINetFTClockModel.h>
 #include <sawATIForceSensor/mtsATINetFTConfig.h>
+#include <sawATIForceSensor/mtsATINetFTGaugeCalibration.h>
+#include <sawATIForceSensor/mtsATINetFTHysteresis.h>
+#include <sawATIForceSensor/mtsATINetFTLatestSample.h>
+#include <sawATIForceSensor/mtsATINetFTRawSample.h>
+#include <sawATIForceSensor/mtsATINetFTReceiver.h>
+#include <sawATIForceSensor/mtsATINetFTToolTransform.h>
+#include <sawATIForceSensor/mtsATINetFTWatchdog.h>
 
 // forward declaration for internal data
 class mtsATINetFTSensorData;
+class mtsATINetFTSharedMemoryWriter;
+class mtsATINetFTMulticastPublisher;
+class mtsATINetFTOutputChannel;
+class mtsATINetFTStatistics;
+class mtsATINetFTCapture;
+class mtsATINetFTReceiveThread;
+class mtsATINetFTTrace;
+class mtsATINetFTTransportBusyPoll;
+class mtsATINetFTInjectionQueue;
 
 // Always include last
 #include <sawATIForceSensor/sawATIForceSensorExport.h>
 
 class CISST_EXPORT mtsATINetFTSensor: public mtsTaskContinuous
 {
-    CMN_DECLARE_SERVICES(CMN_NO_DYNAMIC_CREATION, CMN_LOG_ALLOW_ALL);
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION_ONEARG, CMN_LOG_ALLOW_ALL);
 
 public:
 
@@ -43,32 +64,389 @@ public:
         NO_FILTER = 0
     };
 
-    mtsATINetFTSensor(const std::string & componentName);
-    ~mtsATINetFTSensor() {
-        Socket.Close();
-    }
+    /*! "NoFilter", returns false for other names. */
+    static bool FilterFromString(const std::string & name, FilterType & filter);
+
+    /*! historyDepth is the number of samples kept in the state table,
+      see also SetHistoryDepth. */
+    mtsATINetFTSensor(const std::string & componentName, const size_t historyDepth = 5000);
+    mtsATINetFTSensor(const mtsTaskContinuousConstructorArg & arg);
+    ~mtsATINetFTSensor();
 
     void Startup(void);
     void Run(void);
     void Cleanup(void);
     void CloseSocket(void);
+    /*! Must be called before Startup, use the command "Reconfigure"
+      to change the data source while running. */
     void SetIPAddress(const std::string & ip);
-    void Configure(const std::string & filename) {
-      Configure(filename, 10.0 * cmn_ms, 0);
-    }
+    /*! Configure from a JSON file if the file extension is .json (see
+      share/sawATIForceSensor-example.json), otherwise filename is
+      the ATI XML calibration file.  Settings found in the JSON file
+      override timeout and customPortNumber. */
+    void Configure(const std::string & filename);
     void Configure(const std::string & filename,
                    double timeout = 10.0 * cmn_ms,
                    int customPortNumber = 0);
     void ApplyFilter(const mtsDoubleVec & rawFT, mtsDoubleVec & filteredFT, const FilterType & filter);
 
+    /*! Size of the socket receive buffer (SO_RCVBUF) in bytes, 0 to
+      keep the system default.  Must be called before Startup. */
+    void SetReceiveBufferSize(const int bytes);
+
+    /*! For the custom protocol only, packets contain raw gauge values
+      instead of force/torque.  The gauge offsets and calibration
+      matrix from the calibration file are applied for each sample
+      (see mtsATINetFTGaugeCalibration).  Offsets can be replaced by
+      values measured on the rig with SetGaugeOffsets.  Must be
+      called before Startup. */
+    void SetRawGauges(const bool rawGauges);
+    void SetGaugeOffsets(const vctDouble6 & offsets);
+
+    /*! Number of samples kept in the state table.  Only the raw counts,
+      status and flags are stored (see mtsATINetFTRawSample), the
+      memory used is reported in Startup.  Must be called before the
+      component is connected (e.g. in Configure). */
+    void SetHistoryDepth(const size_t depth);
+
+    /*! Add a decimated output with its own state table and provided
+      interface (named after the channel) with the commands
+      measured_cf and GetPeriodStatistics.  Samples are low pass
+      filtered at the sensor's rate to avoid aliasing, see
+      mtsATINetFTOutputChannel.  Must be called before the component
+      is connected. */
+    bool AddOutputChannel(const std::string & name,
+                          const unsigned int decimation,
+                          const double cutoffRatio = 0.5,
+                          const size_t historyDepth = 256);
+
+    /*! Change the decimation and cutoff ratio of an existing output
+      channel, the filter restarts from the next sample.  Once
+      started, must be called by the component's thread, use the
+      "channels" key of the command "Reconfigure".  Returns false if
+      the channel doesn't exist or the values are invalid. */
+    bool SetOutputChannelFilter(const std::string & name,
+                                const unsigned int decimation,
+                                const double cutoffRatio);
+
+    /*! Add per axis statistics over a sliding window of windowSize
+      samples (see mtsATINetFTStatistics).  The read command
+      "GetStatistics" + name returns a 5x6 matrix, rows are mean,
+      standard deviation (RMS noise), min, max and peak-to-peak.
+      Invalid samples are ignored.  Must be called before the
+      component is connected. */
+    bool AddStatisticsWindow(const std::string & name, const size_t windowSize);
+
+    /*! Pose of the tool frame in the sensor frame.  The read command
+      "measured_cf_tool" returns the latest wrench expressed in the
+      tool frame, at the tool origin (see mtsATINetFTToolTransform).
+      The transform can be changed at runtime with the write command
+      "SetToolTransform" without blocking readers nor acquisition. */
+    void SetToolTransform(const vctFrm3 & sensorToTool);
+
+    /*! Capture full rate samples around events (see
+      mtsATINetFTCapture), files are saved by a background thread in
+      directory.  preTrigger and postTrigger are numbers of samples.
+      Captures can also be triggered with the void command
+      "TriggerCapture".  Must be called before Startup. */
+    bool SetCapture(const size_t preTrigger, const size_t postTrigger,
+                    const std::string & directory, const std::string & prefix = "capture");
+    /*! Record the begin and end times of each stage of the pipeline
+      (receive wait, decode, queue wait, queued commands, sample
+      processing and state table commit) in a ring of capacity events
+      per thread, see mtsATINetFTTrace.  The write command
+      "SaveTrace" (file name, empty for <component>-trace-<date>.json)
+      saves the latest events in the Chrome trace event format from a
+      background thread.  0 to disable (default).  Must be called
+      before Startup. */
+    bool SetTracing(const size_t capacity);
+
+    /*! Capture thresholds, 0 to disable: absolute value per axis, force
+      and torque norms and rate of change per axis (per second). */
+    void SetCaptureThresholds(const vctDouble6 & axis, const double force, const double torque,
+                              const vctDouble6 & rate);
+
+    /*! Contact detection on the force norm, evaluated for each sample
+      in the acquisition loop.  Contact starts when the norm goes
+      above on and ends when it goes below off.  The write events
+      "ContactDetected" and "ContactLost" carry the sample (and its
+      timestamp) that caused the transition.  Set on to 0 to
+      disable. */
+    bool SetContactThresholds(const double on, const double off);
+
+    /*! Overload detection on the largest percentage of the rated
+      range over all axes (requires a calibration file), or when the
+      sensor reports saturation.  Events are "OverloadDetected" and
+      "OverloadCleared".  Set on to 0 to disable. */
+    bool SetOverloadThresholds(const double onPercent, const double offPercent);
+
+    /*! Publish every sample received in a POSIX shared memory ring
+      for out-of-process readers (see mtsATINetFTSharedMemoryReader).
+      Must be called before Startup, not supported on Windows. */
+    void SetSharedMemory(const std::string & name, const unsigned int capacity = 1024);
+
+    /*! Re-publish every sample (force/torque after calibration,
+      timestamp, flags) to a UDP multicast group so other computers
+      can use mtsATINetFTMulticastReceiver instead of connecting to
+      the sensor.  Samples are batched, up to samplesPerDatagram per
+      datagram (see mtsATINetFTMulticast.h), a partial datagram is
+      sent after 2 ms.  ttl is the number of router hops,
+      interfaceAddress the local address to send from (empty for
+      default).  Must be called before Startup, not supported on
+      Windows. */
+    void SetMulticast(const std::string & group, const int port,
+                      const size_t samplesPerDatagram = 7, const int ttl = 1,
+                      const std::string & interfaceAddress = "");
+
+    /*! Source of datagrams (see mtsATINetFTTransport.h): "socket"
+      (default, UDP from the Net F/T box or custom sender, see
+      SetReceiveBackend), "replay" (capture file saved by
+      mtsATINetFTCapture, source is the file name, replayed at speed
+      times the recorded pace), "shared-memory" (ring published by
+      another sensor component, source is its name) or "injection"
+      (datagrams passed to InjectDatagram, for tests).  Replay and
+      shared memory deliver "custom-versioned" datagrams, the protocol
+      is changed accordingly.  Commands (e.g. Rebias) are only sent to
+      the Net F/T box with the socket transport and rdt protocol.
+      Must be called before Startup. */
+    bool SetTransport(const std::string & transport, const std::string & source = "",
+                      const bool loop = false, const double speed = 1.0);
+
+    /*! Push a datagram in the "injection" transport, single producer
+      thread, can be called while the source is switched (see
+      Reconfigure).  Returns false if the queue is full or the
+      component doesn't use the injection transport (or is not
+      started). */
+    bool InjectDatagram(const char * buffer, const size_t size);
+
+    /*! Receive backend for the socket transport, "osaSocket"
+      (default), "io_uring" (Linux 6.0 or higher, see
+      mtsATINetFTTransportIOUring) or "busy-poll" (see
+      mtsATINetFTTransportBusyPoll).  If io_uring is not compiled in
+      or not supported by the kernel, osaSocket is used.  Must be
+      called before Startup. */
+    void SetReceiveBackend(const std::string & backend);
+
+    /*! Budgets for the "busy-poll" backend: spin for spinTime seconds,
+      then yield for yieldTime seconds before blocking.
+      socketBusyPoll is the SO_BUSY_POLL value in microseconds, 0 to
+      leave it unset.  Use with a receive thread pinned to a dedicated
+      core.  The read command "GetBusyPollTimes" returns the seconds
+      spent spinning, yielding and receiving/decoding, copied by the
+      component's thread in Run. */
+    void SetBusyPoll(const double spinTime, const double yieldTime = 0.0,
+                     const int socketBusyPoll = 50);
+
+    /*! Receive, timestamp and decode datagrams in a dedicated thread
+      (see mtsATINetFTReceiveThread) so the socket is read at the
+      same pace whatever the load of queued commands.  The component
+      consumes all queued packets in Run, one state table row per
+      sample.  cpu and priority apply to the receive thread, same as
+      SetCPUAffinity and SetRealTimePriority.  Must be called before
+      Startup. */
+    void SetReceiveThread(const bool enabled, const int cpu = -1, const int priority = 0,
+                          const size_t queueSize = 1024);
+
+    /*! Timestamp samples using the sensor's clock (RDT sequence
+      numbers) mapped to the host clock, see mtsATINetFTClockModel,
+      instead of the time each packet was received.  Enabled by
+      default, not used with the custom protocol (no sequence
+      numbers).  timeConstant is
+      the memory of the fit in seconds, latency is subtracted from
+      all timestamps.  The read command "GetClockModel" returns the
+      sample period (s), jitter removed (RMS, s), number of resets
+      and number of late packets. */
+    void SetClockModel(const bool enabled, const double timeConstant = 10.0,
+                       const double latency = 0.0);
+
+    /*! Stall watchdog, see mtsATINetFTWatchdog.  The stream is
+      stalled when no sample is received for missedIntervals times
+      the interval learned from the stream (plus jitter), usually well
+      before the socket timeout after which the sensor is
+      disconnected.  The write events "Stalled" and "Disconnected"
+      carry the time since the last sample, the read command
+      "GetWatchdog" returns the expected interval, stall threshold
+      (seconds) and the numbers of stalls and disconnects.  0 to
+      disable, default is 3. */
+    void SetStallWatchdog(const double missedIntervals);
+
+    /*! Acquisition mode for the rdt protocol, "continuous" (default,
+      the sensor streams as long as the component runs) or
+      "on-demand": the sensor is stopped until a client requests
+      samples.  The write command "RequestSamples" (int) starts a
+      burst of N samples using the RDT sample count, the event
+      "BurstCompleted" (int, number of samples received) is emitted
+      at the end.  The void commands "Subscribe" and "Unsubscribe"
+      stream continuously while at least one client is subscribed.
+      The sensor is stopped when no burst is pending and nobody is
+      subscribed.  Must be called before Startup. */
+    void SetAcquisitionMode(const std::string & mode);
+
+    /*! Real-time settings for the acquisition thread, applied in
+      Startup (i.e. in the component's thread) and reported in the
+      log.  Linux only.  CPU is the core to pin the thread to, -1 to
+      leave the affinity unchanged.  Priority is the SCHED_FIFO
+      priority (1 to 99), 0 to keep the default scheduler. */
+    void SetCPUAffinity(const int cpu);
+    void SetRealTimePriority(const int priority);
+    /*! Lock all current and future pages in memory (mlockall) and
+      pre-fault stackSize bytes of stack so the acquisition loop never
+      page faults. */
+    void SetLockMemory(const bool lock, const size_t stackSize = 512 * 1024);
+
+    /*! Wait-free access to the latest sample for real-time threads in
+      the same process, Read has a bounded number of retries and
+      returns false if it couldn't get a consistent copy.  The
+      reference is valid as long as the component exists. */
+    inline const mtsATINetFTLatestSample & GetLatestSample(void) const {
+        return LatestSample;
+    }
+
 protected:
+    void Init(void);
+    /*! Parse and apply JSON configuration, requires cisst compiled
+      with JSON support. */
+    bool ConfigureJSON(const std::string & filename);
     void ConnectToSocket(void);
-    void GetReadings(void);
-    void GetReadingsFromCustomPort(void);
+    void ConfigureThread(void);
+    void ConfigureGaugeCalibration(void);
+    bool ConfigureReceiver(void);
+    /*! Create the source for the transport and protocol and keep the
+      receive methods compiled for its type, see SelectReceiveMethod. */
+    template <class _transport, class... _arguments>
+    mtsATINetFTReceiver * CreateSource(const mtsATINetFTReceiver::Protocol protocol,
+                                       _transport * & transport, _arguments & ... arguments);
+    template <class _protocol, class _transport, class... _arguments>
+    mtsATINetFTReceiver * NewSource(_transport * & transport, _arguments & ... arguments);
+    /*! Pick the receive method for the current source, decoder and
+      receive thread, called when the source changes.  Run calls it
+      once, there is no branch nor virtual call per sample. */
+    void SelectReceiveMethod(void);
+    /*! Receive and process the packets available from the source
+      (_source is the type of Receiver), waiting up to timeout for the
+      first one. */
+    template <class _source, bool _rawGauges>
+    void ReceiveFromSource(const double timeout);
+    /*! Same for the packets queued by the receive thread. */
+    template <bool _rawGauges>
+    void ReceiveFromThread(const double timeout);
+    template <class _source>
+    void StartSourceThread(void);
+    /*! Update state for one received packet, or a timeout if packet
+      is null, and advance the state table.  _rawGauges selects the
+      decoder, see DecodePacket. */
+    template <bool _rawGauges>
+    void ProcessSample(const mtsATINetFTPacket * packet);
+    /*! Raw gauges (custom protocols) are calibrated, counts are stored
+      as is. */
+    template <bool _rawGauges>
+    void DecodePacket(const mtsATINetFTPacket & packet);
+    /*! Copy the busy-poll transport times for GetBusyPollTimes, the
+      transport is only used by the component's thread. */
+    void UpdateBusyPollTimes(void);
+    void UpdateSample(const mtsATINetFTPacket & packet);
+    void UpdateFlags(void);
+    void ReportMemoryBudget(void);
+    void DetectContactAndOverload(void);
+    void PublishSharedMemory(const bool newSample);
     void Rebias(void);
-    void CheckSaturation(const unsigned int status);
+    void TriggerCapture(void);
+    void SaveTrace(const std::string & filename);
+    /*! ProcessQueuedCommands, traced if enabled. */
+    void ProcessCommands(void);
+    /*! Unknown names are logged and sent with the event "ErrorMsg". */
     void SetFilter(const std::string & filterName);
-    void CheckForErrors(const unsigned int status);
+    /*! Output channel by name, 0 if it doesn't exist. */
+    mtsATINetFTOutputChannel * GetOutputChannel(const std::string & name) const;
+
+    /*! Read commands, derived from the latest raw sample in the state
+      table when called. */
+    bool GetLatestRawSample(mtsATINetFTRawSample & sample) const;
+    void GetRawData(mtsDoubleVec & forceTorque) const;
+    void GetMeasuredCF(prmForceCartesianGet & forceTorque) const;
+    void GetMeasuredCFTool(prmForceCartesianGet & forceTorque) const;
+    void GetPercentOfMax(mtsDoubleVec & percent) const;
+    void GetIsConnected(bool & isConnected) const;
+    void GetIsSaturated(bool & isSaturated) const;
+    void GetHasError(bool & hasError) const;
+    void GetIsInContact(bool & isInContact) const;
+    void GetIsOverloaded(bool & isOverloaded) const;
+    void GetBusyPollTimes(mtsDoubleVec & times) const;
+    void GetClockModel(mtsDoubleVec & model) const;
+    void GetIsStalled(bool & isStalled) const;
+    void GetWatchdog(mtsDoubleVec & watchdog) const;
+    /*! Longest time to wait for the next packet: socket timeout or
+      watchdog deadline. */
+    double GetReceiveTimeout(void) const;
+    /*! No packet received before GetReceiveTimeout. */
+    void ProcessReceiveTimeout(void);
+
+    /*! Send a streaming command (start or stop) and number of samples
+      to the Net F/T, see section 9.1 in the Net F/T user manual. */
+    bool SendStreamingRequest(const uint16_t command, const uint32_t numberOfSamples);
+    /*! On-demand mode, start, restart or stop streaming based on
+      subscribers and pending bursts.  Returns false if stopped. */
+    bool UpdateStreaming(void);
+    /*! On-demand mode, count a sample received for the current burst. */
+    void CountBurstSample(void);
+    void EndBurst(void);
+    void RequestSamples(const int & numberOfSamples);
+    void Subscribe(void);
+    void Unsubscribe(void);
+    void GetStreamingState(std::string & state) const;
+
+    /*! Runtime reconfiguration, write commands processed by the
+      component's thread between two samples.  "Reconfigure" takes a
+      JSON object with any of the keys "ip", "port", "protocol",
+      "transport", "receive-backend" (data source), "socket-timeout",
+      "calibration-file", "filter" and "channels", same as the
+      configuration file.  For "channels", only the "decimation" and
+      "cutoff-ratio" of existing channels can be changed.  Relative paths are resolved from the working directory.
+      A new data source is opened before the current one is closed
+      (except to bind the same custom port again), so the stream is
+      only interrupted until the first sample of the new source and a
+      source that fails to open leaves the current one unchanged.
+      Errors are logged and sent with the event "ErrorMsg".  The read
+      command "GetReconfiguration" returns the numbers of source
+      switches and failed switches, the last and longest
+      interruptions (time between the last sample of the previous
+      source and the first sample of the new one) and the time the
+      acquisition loop was blocked by the last switch, in seconds. */
+    void Reconfigure(const std::string & configuration);
+    void SetSocketTimeout(const double & timeout);
+    void LoadCalibrationFile(const std::string & filename);
+    void GetReconfiguration(mtsDoubleVec & reconfiguration) const;
+
+    /*! Settings defining the data source, see Reconfigure. */
+    struct SourceSettings {
+        std::string IP;
+        int Port;
+        mtsATINetFTReceiver::Protocol Protocol;
+        std::string TransportType;
+        std::string TransportSource;
+        bool TransportLoop;
+        double TransportSpeed;
+        std::string ReceiveBackend;
+    };
+    void GetSourceSettings(SourceSettings & source) const;
+    void SetSourceSettings(const SourceSettings & source);
+    /*! Open the socket (if used) and receiver for the current source
+      settings, returns false if the receiver can't be opened. */
+    bool OpenSource(void);
+    /*! Stop streaming (Net F/T only) and close receiver and socket. */
+    void CloseSource(osaSocket * socket, mtsATINetFTReceiver * receiver,
+                     const bool sendCommands);
+    /*! Replace the current source at a sample boundary, see
+      Reconfigure. */
+    bool SwitchSource(const SourceSettings & source);
+    /*! Start the receive thread if enabled and select the receive
+      method for the new source. */
+    void StartReceiveThread(void);
+    /*! Stop the receive thread and process the packets it queued. */
+    void StopReceiveThread(void);
+    /*! Load the calibration file, used immediately for percent of
+      max, overload detection and raw gauges. */
+    bool LoadCalibration(const std::string & filename);
 
 private:
     // Configuration
@@ -76,7 +454,12 @@ private:
     bool IsRebiasRequested;
     bool IsSaturated;
     bool HasError;
-    bool IsCalibFileLoaded;
+    // set by Configure, Startup doesn't open the source and Run only
+    // processes commands
+    bool ConfigurationFailed;
+    std::atomic<bool> IsCalibFileLoaded;
+    // copied from the calibration file, can be reloaded while read
+    std::atomic<double> MaxRatings[6];
 
     int ATI_PORT;
     int ATI_COMMAND;
@@ -85,24 +468,157 @@ private:
     // Functions for events
     struct {
         mtsFunctionWrite ErrorMsg;
+        mtsFunctionWrite ContactDetected;
+        mtsFunctionWrite ContactLost;
+        mtsFunctionWrite OverloadDetected;
+        mtsFunctionWrite OverloadCleared;
+        mtsFunctionWrite Stalled;
+        mtsFunctionWrite Disconnected;
+        mtsFunctionWrite BurstCompleted;
+        mtsFunctionWrite CaptureTriggered;
     } EventTriggers;
 
-    // SOcket Information
-    osaSocket Socket;
+    // Contact and overload detection
+    mtsATINetFTHysteresis ContactDetector;
+    mtsATINetFTHysteresis OverloadDetector;
+    prmForceCartesianGet DetectionSample;
+
+    // SOcket Information, replaced when the source changes
+    osaSocket * Socket;
     bool IsConnected;
     bool UseCustomPort;
     double SocketTimeout;
-    mtsDoubleVec FTRawData;
+    mtsATINetFTReceiver::Protocol ReceiveProtocol;
+    // commands can be sent to a Net F/T box, socket transport and rdt protocol
+    bool SendCommands;
+
+    // Raw gauges from custom port
+    bool UseRawGauges;
+    bool HasGaugeOffsets;
+    vctDouble6 GaugeOffsets;
+    mtsATINetFTGaugeCalibration GaugeCalibration;
+    int ReceiveBufferSize;
+
+    // Transport and protocol, optionally received in its own thread
+    mtsATINetFTReceiver * Receiver;
+    typedef void (mtsATINetFTSensor::*ReceiveMethod)(const double timeout);
+    typedef void (mtsATINetFTSensor::*StartThreadMethod)(void);
+    // methods compiled for the type of Receiver, set by NewSource
+    struct SourceMethods {
+        ReceiveMethod Counts;
+        ReceiveMethod RawGauges;
+        StartThreadMethod StartThread;
+    } ReceiverMethods;
+    ReceiveMethod ReceiveAndProcess;
+    mtsATINetFTReceiveThread * ReceiveThread;
+    mtsATINetFTPacket Packet;
+    std::string TransportType;
+    std::string TransportSource;
+    bool TransportLoop;
+    double TransportSpeed;
+    // created once, kept across source switches for InjectDatagram
+    std::atomic<mtsATINetFTInjectionQueue *> InjectionQueue;
+    std::atomic<bool> UseInjection;
+    std::string ReceiveBackend;
+    mtsATINetFTTransportBusyPoll * BusyPollTransport;
+    double BusyPollSpinTime;
+    double BusyPollYieldTime;
+    int BusyPollSocket;
+    // spinning, yielding and productive, see UpdateBusyPollTimes
+    std::atomic<double> BusyPollTimes[3];
+    bool UseReceiveThread;
+    int ReceiveThreadCPU;
+    int ReceiveThreadPriority;
+    size_t ReceiveQueueSize;
+
+    // Sensor clock to host clock, updated by the acquisition thread
+    bool ClockModelEnabled;
+    bool UseClockModel;
+    mtsATINetFTClockModel ClockModel;
+    std::atomic<double> ClockPeriod;
+    std::atomic<double> ClockJitter;
+    std::atomic<size_t> ClockResets;
+    std::atomic<size_t> ClockLatePackets;
+
+    // Stall and disconnect detection
+    mtsATINetFTWatchdog Watchdog;
+    bool IsReceiving;
+    double LastPacketTime;
+    std::atomic<bool> IsStalled;
+    std::atomic<double> WatchdogInterval;
+    std::atomic<double> WatchdogThreshold;
+    std::atomic<size_t> NumberOfStalls;
+    std::atomic<size_t> NumberOfDisconnects;
 
-    /// force / max force for each axis. in 0-100.
-    mtsDoubleVec PercentOfMaxVec;
-  
-    prmForceCartesianGet ForceTorque;
+    // Runtime reconfiguration, interruption measured on the next sample
+    bool MeasuringInterruption;
+    double InterruptionStart;
+    std::atomic<size_t> NumberOfSourceSwitches;
+    std::atomic<size_t> NumberOfFailedSwitches;
+    std::atomic<double> LastInterruption;
+    std::atomic<double> LongestInterruption;
+    std::atomic<double> LastSwitchBlocking;
+
+    // On-demand acquisition
+    enum StreamingState {
+        STREAMING_STOPPED = 0,
+        STREAMING_BURST,
+        STREAMING_CONTINUOUS
+    };
+    bool OnDemand;
+    std::atomic<int> Streaming;
+    size_t NumberOfSubscribers;
+    uint32_t BurstRemaining;
+    uint32_t BurstReceived;
+    bool BurstChanged;
+    double StreamingRequestTime;
+
+    // Only data stored in the state table
+    mtsATINetFTRawSample RawSample;
+    mtsStateTable::Accessor<mtsATINetFTRawSample> * RawSampleAccessor;
+
+    // Sensor to tool transform, applied when read
+    mtsATINetFTToolTransform ToolTransform;
 
     std::string  IP;
 
     mtsATINetFTSensorData * Data;
     FilterType CurrentFilter;
+
+    // Decimated outputs
+    std::vector<mtsATINetFTOutputChannel *> OutputChannels;
+
+    // Sliding window statistics
+    std::vector<mtsATINetFTStatistics *> StatisticsWindows;
+
+    // Pre/post trigger capture
+    mtsATINetFTCapture * Capture;
+
+    // Per stage timing, tracks for the component and receive threads
+    mtsATINetFTTrace * Trace;
+
+    // Latest sample, also used for shared memory
+    mtsATINetFTSharedMemorySample Sample;
+    mtsATINetFTLatestSample LatestSample;
+
+    // Acquisition thread settings
+    int ThreadCPU;
+    int ThreadPriority;
+    bool ThreadLockMemory;
+    size_t ThreadPrefaultStackSize;
+
+    // Shared memory publisher
+    std::string SharedMemoryName;
+    unsigned int SharedMemoryCapacity;
+    mtsATINetFTSharedMemoryWriter * SharedMemory;
+
+    // UDP multicast re-publishing
+    std::string MulticastGroup;
+    int MulticastPort;
+    size_t MulticastSamplesPerDatagram;
+    int MulticastTTL;
+    std::string MulticastInterface;
+    mtsATINetFTMulticastPublisher * Multicast;
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(mtsATINetFTSensor);
@@ -0,0 +1,83 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTSharedMemory_h
+#define _mtsATINetFTSharedMemory_h
+
+// This file only depends on the standard library so out-of-process
+// readers don't need cisst.  The layout is fixed size and little
+// endian, see README.md for a description usable from other languages.
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#define ATI_NETFT_SHM_MAGIC "ATIFTSHM"
+#define ATI_NETFT_SHM_VERSION 1
+
+/*! Flags used in mtsATINetFTSharedMemorySample::Flags and
+  mtsATINetFTSharedMemoryHeader::Status. */
+enum {
+    ATI_NETFT_SHM_VALID = 0x01,
+    ATI_NETFT_SHM_SATURATED = 0x02,
+    ATI_NETFT_SHM_ERROR = 0x04,
+    ATI_NETFT_SHM_CONNECTED = 0x08,
+    ATI_NETFT_SHM_WRITER_ACTIVE = 0x10,
+    ATI_NETFT_SHM_CONTACT = 0x20,
+    ATI_NETFT_SHM_OVERLOAD = 0x40
+};
+
+/*! Payload for each sample, plain data so readers can copy it. */
+struct mtsATINetFTSharedMemorySample {
+    uint64_t Index;          // number of samples published before this one
+    double Timestamp;        // host time, same time base as cisstMultiTask
+    uint32_t RdtSequence;
+    uint32_t FtSequence;
+    uint32_t Status;         // raw status word from the Net F/T
+    uint32_t Flags;          // ATI_NETFT_SHM_VALID...
+    double ForceTorque[6];   // Fx, Fy, Fz, Tx, Ty, Tz
+};
+
+/*! One ring slot protected by its own seqlock.  Sequence is odd while
+  the writer updates Data. */
+struct mtsATINetFTSharedMemorySlot {
+    std::atomic<uint32_t> Sequence;
+    uint32_t Padding;
+    mtsATINetFTSharedMemorySample Data;
+};
+
+/*! Header at the beginning of the shared memory segment, followed by
+  Capacity slots. */
+struct mtsATINetFTSharedMemoryHeader {
+    char Magic[8];
+    uint32_t Version;
+    uint32_t HeaderSize;
+    uint32_t SlotSize;
+    uint32_t Capacity;
+    std::atomic<uint32_t> Status;      // ATI_NETFT_SHM_WRITER_ACTIVE | ATI_NETFT_SHM_CONNECTED
+    uint32_t Padding;
+    std::atomic<uint64_t> WriteCount;  // total number of samples published
+    uint8_t Reserved[16];
+};
+
+inline size_t mtsATINetFTSharedMemorySize(const uint32_t capacity) {
+    return sizeof(mtsATINetFTSharedMemoryHeader)
+        + static_cast<size_t>(capacity) * sizeof(mtsATINetFTSharedMemorySlot);
+}
+
+#endif // _mtsATINetFTSharedMemory_h
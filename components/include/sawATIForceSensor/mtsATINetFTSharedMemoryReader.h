@@ -0,0 +1,91 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTSharedMemoryReader_h
+#define _mtsATINetFTSharedMemoryReader_h
+
+#include <string>
+#include <sawATIForceSensor/mtsATINetFTSharedMemory.h>
+
+/*! Reader for the shared memory ring published by mtsATINetFTSensor.
+  Readers never block the writer nor each other.  A read only retries
+  if the writer wrapped around the whole ring while the slot was being
+  copied, which requires the reader to be preempted for Capacity
+  samples.  Retries are bounded (MaximumRetries) so readers survive a
+  writer that died while updating a slot. */
+class mtsATINetFTSharedMemoryReader
+{
+public:
+    enum {MaximumRetries = 256};
+
+    mtsATINetFTSharedMemoryReader(void);
+    ~mtsATINetFTSharedMemoryReader();
+
+    /*! Map the named segment read-only and check magic/version/sizes. */
+    bool Open(const std::string & name, std::string & errorMessage);
+    void Close(void);
+    inline bool IsOpen(void) const {
+        return (Header != 0);
+    }
+
+    /*! Writer has the segment opened.  If false, the sensor component
+      has been stopped and the reader should re-open the segment. */
+    bool IsWriterActive(void) const;
+    bool IsConnected(void) const;
+    uint32_t GetCapacity(void) const;
+
+    /*! Number of samples published so far, index of the next sample. */
+    uint64_t GetWriteCount(void) const;
+
+    /*! Copy the most recent sample, returns false if nothing has been
+      published yet or no consistent copy could be made (writer
+      inactive or MaximumRetries reached). */
+    bool GetLatest(mtsATINetFTSharedMemorySample & sample) const;
+
+    /*! Copy sample with given index, returns false if the sample has
+      not been published yet or has already been overwritten. */
+    bool Get(const uint64_t index, mtsATINetFTSharedMemorySample & sample) const;
+
+    /*! Copy up to maxSamples samples starting at nextIndex and update
+      nextIndex.  If the reader fell behind, nextIndex jumps to the
+      oldest sample still available and the number of samples lost is
+      returned in lost.  Stops early if a slot can't be read
+      consistently, see GetLatest. */
+    size_t GetSince(uint64_t & nextIndex,
+                    mtsATINetFTSharedMemorySample * samples,
+                    const size_t maxSamples,
+                    uint64_t & lost) const;
+
+    /*! Raw access to the mapped memory for zero-copy readers, data in
+      slots must be validated with the slot's sequence number. */
+    inline const mtsATINetFTSharedMemoryHeader * GetHeader(void) const {
+        return Header;
+    }
+    inline const mtsATINetFTSharedMemorySlot * GetSlots(void) const {
+        return Slots;
+    }
+
+protected:
+    bool ReadSlot(const uint64_t index, mtsATINetFTSharedMemorySample & sample) const;
+
+    size_t Size;
+    const mtsATINetFTSharedMemoryHeader * Header;
+    const mtsATINetFTSharedMemorySlot * Slots;
+};
+
+#endif // _mtsATINetFTSharedMemoryReader_h
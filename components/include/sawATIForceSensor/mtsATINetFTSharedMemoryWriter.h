@@ -0,0 +1,65 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTSharedMemoryWriter_h
+#define _mtsATINetFTSharedMemoryWriter_h
+
+#include <string>
+#include <sawATIForceSensor/mtsATINetFTSharedMemory.h>
+
+/*! Single writer for the POSIX shared memory ring.  Only one thread
+  should call Publish.  Publish doesn't allocate nor make system
+  calls. */
+class mtsATINetFTSharedMemoryWriter
+{
+public:
+    mtsATINetFTSharedMemoryWriter(void);
+    ~mtsATINetFTSharedMemoryWriter();
+
+    /*! Create (or re-create) the named segment with capacity slots.
+      Name is prefixed with '/' if needed. */
+    bool Open(const std::string & name, const uint32_t capacity,
+              std::string & errorMessage);
+    /*! Mark the writer inactive, unmap and unlink the segment. */
+    void Close(void);
+    inline bool IsOpen(void) const {
+        return (Header != 0);
+    }
+    inline const std::string & GetName(void) const {
+        return Name;
+    }
+    inline uint32_t GetCapacity(void) const {
+        return Capacity;
+    }
+
+    /*! Copy sample in the next slot, Index is set by the writer. */
+    void Publish(const mtsATINetFTSharedMemorySample & sample);
+
+    /*! Update connection bit in header, writer active bit is preserved. */
+    void SetConnected(const bool connected);
+
+protected:
+    std::string Name;
+    uint32_t Capacity;
+    size_t Size;
+    uint64_t Count;
+    mtsATINetFTSharedMemoryHeader * Header;
+    mtsATINetFTSharedMemorySlot * Slots;
+};
+
+#endif // _mtsATINetFTSharedMemoryWriter_h
@@ -0,0 +1,119 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTSource_h
+#define _mtsATINetFTSource_h
+
+#include <sawATIForceSensor/mtsATINetFTReceiver.h>
+#include <sawATIForceSensor/mtsATINetFTTransport.h>
+
+/*! Transport and protocol composed at compile time.  _transport
+  provides:
+  - Open(errorMessage), Close() and GetName()
+  - ReceiveDatagram(datagram, timeout): wait up to timeout seconds,
+    returns the size of the datagram pointed to by datagram (valid
+    until ReleaseDatagram), 0 or less on timeout or error
+  - ReleaseDatagram(), called once the datagram is decoded
+  _protocol is one of the decoders in mtsATINetFTProtocol.h.
+
+  Receive, the transport calls and the decoder are specialized for
+  each combination.  Receive is not virtual, callers are compiled for
+  the source type (see mtsATINetFTSensor::ReceiveFromSource and
+  mtsATINetFTReceiveThread::Start) so there is no branch on the
+  protocol nor virtual call per datagram.  Transports are constructed
+  with the arguments given to the source's constructor. */
+template <class _transport, class _protocol>
+class mtsATINetFTSource: public mtsATINetFTReceiver
+{
+public:
+    typedef _transport TransportType;
+    typedef _protocol ProtocolType;
+
+    inline mtsATINetFTSource(void):
+        NumberOfInvalidPackets(0)
+    {}
+
+    /*! Arguments are forwarded to the transport constructor. */
+    template <class... _arguments>
+    inline mtsATINetFTSource(_arguments & ... arguments):
+        Transport(arguments...),
+        NumberOfInvalidPackets(0)
+    {}
+
+    bool Open(std::string & errorMessage) {
+        return Transport.Open(errorMessage);
+    }
+
+    void Close(void) {
+        Transport.Close();
+    }
+
+    /*! Wait up to timeout seconds for a valid datagram, 0 to only
+      get a datagram already received.  Invalid datagrams are counted
+      and skipped but the overall wait is bounded by timeout, so a
+      stream of invalid datagrams is reported like no datagram at
+      all. */
+    inline bool Receive(mtsATINetFTPacket & packet, const double timeout) {
+        const char * datagram;
+        const double deadline = mtsATINetFTTransport::GetTime() + timeout;
+        double remaining = timeout;
+        for (;;) {
+            const int size = Transport.ReceiveDatagram(datagram, remaining);
+            if (size <= 0) {
+                return false;
+            }
+            packet.ReceiveTime = mtsATINetFTTransport::GetTime();
+            const bool valid = _protocol::Decode(datagram, static_cast<size_t>(size), packet);
+            Transport.ReleaseDatagram();
+            if (valid) {
+                return true;
+            }
+            ++NumberOfInvalidPackets;
+            remaining = deadline - packet.ReceiveTime;
+            if (remaining <= 0.0) {
+                return false;
+            }
+        }
+    }
+
+    const char * GetName(void) const {
+        return Transport.GetName();
+    }
+
+    const char * GetProtocolName(void) const {
+        return _protocol::GetName();
+    }
+
+    bool HasSequence(void) const {
+        return (_protocol::HAS_SEQUENCE != 0);
+    }
+
+    size_t GetNumberOfInvalidPackets(void) const {
+        return NumberOfInvalidPackets;
+    }
+
+    inline _transport & GetTransport(void) {
+        return Transport;
+    }
+
+protected:
+    _transport Transport;
+    size_t NumberOfInvalidPackets;
+};
+
+#endif // _mtsATINetFTSource_h
@@ -0,0 +1,122 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTStatistics_h
+#define _mtsATINetFTStatistics_h
+
+#include <atomic>
+#include <vector>
+#include <cisstVector/vctFixedSizeVectorTypes.h>
+#include <cisstVector/vctDynamicMatrixTypes.h>
+#include <cisstMultiTask/mtsMatrix.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Per axis statistics over a sliding window of samples.  Adding a
+  sample is O(1), worst case included: sums are updated incrementally
+  and min/max use monotonic queues.  Removing old samples from the
+  sums accumulates rounding errors, so a second set of sums is built
+  from new samples only and replaces the running sums once it covers
+  the whole window.  All buffers are allocated in the constructor.
+
+  Statistics are derived when read: Add only publishes the current
+  sums and extrema (seqlock, single writer) and GetStatistics computes
+  the matrix in the reader's thread. */
+class CISST_EXPORT mtsATINetFTStatistics
+{
+public:
+    /*! Rows of the statistics matrix, columns are Fx, Fy, Fz, Tx, Ty, Tz. */
+    enum {
+        MEAN = 0,
+        STANDARD_DEVIATION,
+        MINIMUM,
+        MAXIMUM,
+        PEAK_TO_PEAK,
+        NUMBER_OF_ROWS
+    };
+
+    mtsATINetFTStatistics(const std::string & name, const size_t windowSize);
+
+    /*! Reset and Add must be called by a single thread, the
+      acquisition thread. */
+    void Reset(void);
+    void Add(const double * forceTorque, const double timestamp = 0.0);
+
+    /*! Number of samples currently in the window. */
+    inline size_t GetCount(void) const {
+        return Count;
+    }
+    inline size_t GetWindowSize(void) const {
+        return WindowSize;
+    }
+    inline const std::string & GetName(void) const {
+        return Name;
+    }
+
+    /*! Compute statistics from the last published sums, result is
+      resized to NUMBER_OF_ROWS x 6, timestamp is the last sample's
+      and result is invalid if the window is empty.  Thread safe, used
+      as read command. */
+    void GetStatistics(mtsDoubleMat & result) const;
+
+protected:
+    /*! Data needed to compute statistics, copied after each sample. */
+    struct Snapshot {
+        size_t Count;
+        double Timestamp;
+        vct6 Offset;
+        vct6 Sum;
+        vct6 SumOfSquares;
+        vct6 Minimum;
+        vct6 Maximum;
+    };
+    void Publish(const double timestamp);
+
+    /*! Fixed capacity monotonic queue of sample indices. */
+    struct MonotonicQueue {
+        std::vector<size_t> Indices;
+        size_t Head;
+        size_t Size;
+    };
+    void PushMinimum(MonotonicQueue & queue, const size_t axis, const double value);
+    void PushMaximum(MonotonicQueue & queue, const size_t axis, const double value);
+    void PopExpired(MonotonicQueue & queue);
+
+    std::string Name;
+    size_t WindowSize;
+    size_t Count;
+    size_t Total;          // samples added since reset
+
+    std::vector<vct6> Samples;
+    vct6 Offset;           // sums are computed on value - offset for precision
+    vct6 Sum;
+    vct6 SumOfSquares;
+    // sums of the last FreshCount samples, never subtracted from
+    size_t FreshCount;
+    vct6 FreshOffset;
+    vct6 FreshSum;
+    vct6 FreshSumOfSquares;
+    MonotonicQueue Minimums[6];
+    MonotonicQueue Maximums[6];
+
+    std::atomic<uint32_t> Sequence;
+    Snapshot Published;
+};
+
+#endif // _mtsATINetFTStatistics_h
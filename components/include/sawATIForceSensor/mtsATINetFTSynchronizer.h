@@ -0,0 +1,96 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTSynchronizer_h
+#define _mtsATINetFTSynchronizer_h
+
+#include <string>
+#include <vector>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Puts samples from several sensors on a common timeline.  Each
+  sensor keeps a short history of timestamped force/torque values
+  (Add), a frame at a given time is built by picking, for each
+  sensor, the nearest sample or a linear interpolation between the
+  samples before and after (Match).  Not thread safe, used by the
+  acquisition thread only. */
+class CISST_EXPORT mtsATINetFTSynchronizer
+{
+public:
+    enum Mode {
+        NEAREST = 0,
+        INTERPOLATE
+    };
+
+    mtsATINetFTSynchronizer(void);
+
+    /*! Number of sensors and samples kept per sensor, the history
+      must cover the longest wait before a frame is built.  Clears
+      all samples. */
+    void Resize(const size_t numberOfSensors, const size_t historySize);
+
+    /*! "nearest" or "interpolate". */
+    static bool ModeFromString(const std::string & name, Mode & mode);
+
+    inline void SetMode(const Mode mode) {
+        FrameMode = mode;
+    }
+
+    inline Mode GetMode(void) const {
+        return FrameMode;
+    }
+
+    inline size_t GetNumberOfSensors(void) const {
+        return History.size();
+    }
+
+    void Add(const size_t sensor, const double time,
+             const double * forceTorque, const bool valid);
+
+    /*! Time of the most recent sample, 0 if none yet. */
+    double GetLatestTime(const size_t sensor) const;
+
+    /*! Fill forceTorque (6 values per sensor) for the given time.
+      skew is the largest distance between the frame time and the
+      closest sample of any sensor.  Returns false if a sensor has no
+      valid sample within maxAge of the frame time, values for that
+      sensor are then set to 0. */
+    bool Match(const double time, const double maxAge,
+               double * forceTorque, double & skew) const;
+
+protected:
+    struct Sample {
+        double Time;
+        double ForceTorque[6];
+        bool Valid;
+    };
+
+    /*! Samples for one sensor, returns false if none is within
+      maxAge. */
+    bool MatchSensor(const size_t sensor, const double time, const double maxAge,
+                     double * forceTorque, double & distance) const;
+
+    Mode FrameMode;
+    size_t HistorySize;
+    std::vector<std::vector<Sample> > History;
+    std::vector<size_t> Counts;
+};
+
+#endif // _mtsATINetFTSynchronizer_h
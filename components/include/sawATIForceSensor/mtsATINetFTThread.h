@@ -0,0 +1,43 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTThread_h
+#define _mtsATINetFTThread_h
+
+#include <stddef.h>
+#include <string>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Real-time settings for the calling thread, Linux only.  Used by the
+  acquisition thread of mtsATINetFTSensor and mtsATINetFTMultiSensor
+  and by mtsATINetFTReceiveThread.  cpu is the core to pin the thread
+  to (-1 to leave the affinity unchanged), priority the SCHED_FIFO
+  priority (1 to 99, 0 to keep the default scheduler).  If lockMemory
+  is set, all current and future pages are locked (mlockall) and
+  prefaultStackSize bytes of stack are touched so the thread never
+  page faults.  Failures are logged and ignored, the settings applied
+  are reported in the log using name. */
+CISST_EXPORT void mtsATINetFTConfigureCurrentThread(const std::string & name,
+                                                    const int cpu,
+                                                    const int priority,
+                                                    const bool lockMemory = false,
+                                                    const size_t prefaultStackSize = 0);
+
+#endif // _mtsATINetFTThread_h
@@ -0,0 +1,68 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTToolTransform_h
+#define _mtsATINetFTToolTransform_h
+
+#include <atomic>
+#include <stdint.h>
+
+#include <cisstVector/vctTransformationTypes.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Transformation of wrenches from the sensor frame to a tool frame.
+  The transform is the tool frame's pose in the sensor frame (R, p),
+  the wrench is expressed in the tool frame, at the tool origin:
+
+  f_tool = R^T f, t_tool = R^T (t - p x f)
+
+  The 6x6 adjoint is precomputed in Set.  Set is meant to be called by
+  a single thread (the sensor's acquisition thread, through a queued
+  command) while Get and Apply can be called from any thread; they
+  use a sequence lock so neither side ever blocks. */
+class CISST_EXPORT mtsATINetFTToolTransform
+{
+public:
+    mtsATINetFTToolTransform(void);
+
+    void Set(const vctFrm3 & sensorToTool);
+    void Get(vctFrm3 & sensorToTool) const;
+
+    /*! Returns true if the transform is not identity. */
+    inline bool IsSet(void) const {
+        return NotIdentity.load(std::memory_order_relaxed);
+    }
+
+    /*! Transform a sensor frame wrench (Fx, Fy, Fz, Tx, Ty, Tz). */
+    void Apply(const double * sensor, double * tool) const;
+
+protected:
+    struct Data {
+        double Adjoint[6][6];
+        vctFrm3 Transform;
+    };
+    void Read(Data & data) const;
+
+    std::atomic<uint32_t> Sequence;
+    std::atomic<bool> NotIdentity;
+    Data Current;
+};
+
+#endif // _mtsATINetFTToolTransform_h
@@ -0,0 +1,138 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTTrace_h
+#define _mtsATINetFTTrace_h
+
+#include <atomic>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaThreadSignal.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Per stage timing of the acquisition pipeline.  Each thread
+  recording events has its own track, a ring of preallocated events
+  with a single writer, so Record never blocks nor allocates and only
+  the latest events are kept.  Save only posts a request, a background
+  thread copies the rings (events overwritten during the copy are
+  dropped) and writes them in the Chrome trace event format (JSON), which can be
+  opened with Perfetto (ui.perfetto.dev) or chrome://tracing.  Times
+  are the cisstMultiTask relative time, in microseconds in the file,
+  so traces of components in the same process line up. */
+class CISST_EXPORT mtsATINetFTTrace
+{
+public:
+    enum Stage {
+        RECEIVE_WAIT = 0,   // waiting for a datagram
+        RECEIVE_TIMEOUT,    // no datagram before the timeout
+        DECODE,             // datagram received to packet decoded
+        QUEUE_WAIT,         // component waiting for the receive thread
+        COMMANDS,           // ProcessQueuedCommands
+        PROCESS_SAMPLE,     // packet to state table, events and outputs
+        COMMIT,             // state table Advance
+        NUMBER_OF_STAGES
+    };
+
+    struct Event {
+        double Begin;
+        double End;
+        uint32_t Stage;
+        uint32_t Sequence;   // RDT or versioned custom sequence, 0 if unknown
+    };
+
+    mtsATINetFTTrace(void);
+    ~mtsATINetFTTrace();
+
+    /*! Allocate capacity events for each track.  Must be called
+      before Start. */
+    bool Configure(const size_t capacity, const size_t numberOfTracks);
+
+    /*! Name shown for a track, e.g. the thread name. */
+    void SetTrackName(const size_t track, const std::string & name);
+
+    /*! Use the calling thread's id for the track so threads of other
+      components don't overlap, to be called by the writer thread. */
+    void SetTrackThread(const size_t track);
+
+    /*! Start and stop the writer thread.  Stop saves the pending
+      trace. */
+    bool Start(void);
+    void Stop(void);
+
+    inline bool IsConfigured(void) const {
+        return !Tracks.empty();
+    }
+
+    /*! Same clock as packets' receive time. */
+    static double GetTime(void);
+
+    /*! Add an event, only one thread per track. */
+    inline void Record(const size_t track, const Stage stage,
+                       const double begin, const double end,
+                       const uint32_t sequence = 0) {
+        Track & current = *(Tracks[track]);
+        const size_t count = current.Count.load(std::memory_order_relaxed);
+        Event & event = current.Events[count % current.Events.size()];
+        event.Begin = begin;
+        event.End = end;
+        event.Stage = stage;
+        event.Sequence = sequence;
+        current.Count.store(count + 1, std::memory_order_release);
+    }
+
+    /*! Ask the writer thread to copy the events of all tracks and
+      save them in filename, or processName-trace-<date>.json if
+      empty.  Doesn't copy nor block, can be called from any thread,
+      returns false if the previous trace is not saved yet. */
+    bool Save(const std::string & filename, const std::string & processName);
+
+    static const char * GetStageName(const Stage stage);
+
+protected:
+    struct Track {
+        std::vector<Event> Events;
+        std::atomic<size_t> Count;   // number of events recorded
+        std::string Name;
+        long ThreadId;
+        std::vector<Event> Snapshot; // oldest first, used by writer thread
+    };
+
+    void * WriterLoop(int);
+    /*! Copy each ring in its snapshot, the count is read before and
+      after so events overwritten during the copy are dropped. */
+    void Copy(void);
+    void Write(void);
+
+    std::vector<Track *> Tracks;
+
+    // writer thread, Pending is set from Save until the trace is saved
+    std::atomic<bool> Pending;
+    std::atomic<bool> Requested;
+    std::string FileName;
+    std::string ProcessName;
+    osaThread WriterThread;
+    osaThreadSignal WriterSignal;
+    std::atomic<bool> WriterRunning;
+};
+
+#endif // _mtsATINetFTTrace_h
@@ -0,0 +1,241 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTTransport_h
+#define _mtsATINetFTTransport_h
+
+#include <string>
+#include <vector>
+
+#include <cisstCommon/cmnPortability.h>
+#include <cisstOSAbstraction/osaSocket.h>
+#include <cisstOSAbstraction/osaThreadSignal.h>
+
+#include <sawATIForceSensor/mtsATINetFTProtocol.h>
+#include <sawATIForceSensor/mtsATINetFTQueue.h>
+
+#if (CISST_OS != CISST_WINDOWS)
+#include <sawATIForceSensor/mtsATINetFTSharedMemoryReader.h>
+#endif
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Transports deliver datagrams to mtsATINetFTSource, see
+  mtsATINetFTSource.h for the methods required.  They are not
+  polymorphic, each source is compiled for one transport and one
+  protocol.  Other transports: mtsATINetFTTransportBusyPoll and
+  mtsATINetFTTransportIOUring. */
+class CISST_EXPORT mtsATINetFTTransport
+{
+public:
+    /*! Host time for timestamps, same time base as cisstMultiTask. */
+    static double GetTime(void);
+
+    inline void ReleaseDatagram(void) {}
+};
+
+/*! Blocking receive on the osaSocket configured by the sensor
+  component. */
+class CISST_EXPORT mtsATINetFTTransportSocket: public mtsATINetFTTransport
+{
+public:
+    inline mtsATINetFTTransportSocket(osaSocket & socket):
+        Socket(socket)
+    {}
+
+    inline bool Open(std::string & /*errorMessage*/) {
+        return true;
+    }
+
+    inline void Close(void) {}
+
+    inline const char * GetName(void) const {
+        return "osaSocket";
+    }
+
+    inline int ReceiveDatagram(const char * & datagram, const double timeout) {
+        datagram = Buffer;
+        return Socket.Receive(Buffer, sizeof(Buffer), timeout);
+    }
+
+protected:
+    osaSocket & Socket;
+    char Buffer[512];
+};
+
+/*! Replays a capture file saved by mtsATINetFTCapture (CSV, one
+  sample per line) at the recorded pace, scaled by speed.  Samples
+  are delivered as mtsATINetFTProtocolCustomVersioned datagrams with
+  the recorded force/torque, flags and sequence (RDT sequence if
+  recorded, sample index otherwise), so use the "custom-versioned"
+  protocol.  Timestamps are the replay time.  At the end of the
+  file, replay starts again if loop is set. */
+class CISST_EXPORT mtsATINetFTTransportReplay: public mtsATINetFTTransport
+{
+public:
+    mtsATINetFTTransportReplay(void);
+
+    inline void SetFile(const std::string & filename, const bool loop = false,
+                        const double speed = 1.0) {
+        FileName = filename;
+        Loop = loop;
+        Speed = (speed > 0.0) ? speed : 1.0;
+    }
+
+    /*! Load the whole file. */
+    bool Open(std::string & errorMessage);
+    void Close(void);
+
+    inline const char * GetName(void) const {
+        return "replay";
+    }
+
+    int ReceiveDatagram(const char * & datagram, const double timeout);
+
+    inline size_t GetNumberOfSamples(void) const {
+        return Samples.size();
+    }
+
+protected:
+    struct Sample {
+        double Time;
+        uint32_t Sequence;
+        uint32_t Flags;
+        double ForceTorque[6];
+    };
+
+    std::string FileName;
+    bool Loop;
+    double Speed;
+    std::vector<Sample> Samples;
+    size_t Next;
+    // host time of the first sample of the current pass, set by the first receive
+    bool Started;
+    double StartTime;
+    char Buffer[mtsATINetFTProtocolCustomVersioned::SIZE];
+};
+
+/*! Datagrams pushed by another thread with Inject, for tests and
+  simulation without network.  The queue is owned by the sensor
+  component and outlives the transports reading it, so Inject can be
+  called while the component switches sources.  Inject and Pop never
+  allocate, datagrams larger than MAX_SIZE are rejected. */
+class CISST_EXPORT mtsATINetFTInjectionQueue
+{
+public:
+    enum {MAX_SIZE = 128};
+
+    struct Datagram {
+        size_t Size;
+        char Data[MAX_SIZE];
+    };
+
+    mtsATINetFTInjectionQueue(const size_t queueSize = 1024);
+
+    /*! Producer side, single thread.  Returns false if the queue is
+      full or the datagram too large. */
+    bool Inject(const char * buffer, const size_t size);
+
+    /*! Consumer side, single thread at a time.  Wait up to timeout
+      seconds, returns false if no datagram was pushed. */
+    bool Pop(Datagram & datagram, const double timeout);
+
+protected:
+    mtsATINetFTQueue<Datagram> Queue;
+    osaThreadSignal Signal;
+};
+
+/*! Reads the datagrams of a mtsATINetFTInjectionQueue.  Any protocol
+  can be used. */
+class CISST_EXPORT mtsATINetFTTransportInjection: public mtsATINetFTTransport
+{
+public:
+    inline mtsATINetFTTransportInjection(mtsATINetFTInjectionQueue & queue):
+        Queue(queue)
+    {
+        Current.Size = 0;
+    }
+
+    inline bool Open(std::string & /*errorMessage*/) {
+        return true;
+    }
+
+    inline void Close(void) {}
+
+    inline const char * GetName(void) const {
+        return "injection";
+    }
+
+    inline int ReceiveDatagram(const char * & datagram, const double timeout) {
+        if (!Queue.Pop(Current, timeout)) {
+            return 0;
+        }
+        datagram = Current.Data;
+        return static_cast<int>(Current.Size);
+    }
+
+protected:
+    mtsATINetFTInjectionQueue & Queue;
+    mtsATINetFTInjectionQueue::Datagram Current;
+};
+
+#if (CISST_OS != CISST_WINDOWS)
+/*! Reads the shared memory ring published by another sensor
+  component (see mtsATINetFTSharedMemoryReader), e.g. to run
+  processing in a separate process without a second connection to
+  the sensor.  There is no notification, the ring is polled every
+  PollPeriod seconds.  Samples are delivered as
+  mtsATINetFTProtocolCustomVersioned datagrams (sequence is the
+  sample index), so use the "custom-versioned" protocol.  Samples
+  overwritten before they are read are counted as lost. */
+class CISST_EXPORT mtsATINetFTTransportSharedMemory: public mtsATINetFTTransport
+{
+public:
+    mtsATINetFTTransportSharedMemory(void);
+
+    inline void SetName(const std::string & name, const double pollPeriod = 100.0e-6) {
+        Name = name;
+        PollPeriod = pollPeriod;
+    }
+
+    /*! Only new samples are delivered. */
+    bool Open(std::string & errorMessage);
+    void Close(void);
+
+    inline const char * GetName(void) const {
+        return "shared-memory";
+    }
+
+    int ReceiveDatagram(const char * & datagram, const double timeout);
+
+    inline uint64_t GetNumberOfLostSamples(void) const {
+        return NumberOfLostSamples;
+    }
+
+protected:
+    std::string Name;
+    double PollPeriod;
+    mtsATINetFTSharedMemoryReader Reader;
+    uint64_t NextIndex;
+    uint64_t NumberOfLostSamples;
+    char Buffer[mtsATINetFTProtocolCustomVersioned::SIZE];
+};
+#endif
+
+#endif // _mtsATINetFTTransport_h
@@ -0,0 +1,102 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTTransportBusyPoll_h
+#define _mtsATINetFTTransportBusyPoll_h
+
+#include <atomic>
+#include <time.h>
+
+#include <sawATIForceSensor/mtsATINetFTTransport.h>
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Low latency transport that busy-polls the socket with
+  non-blocking reads instead of sleeping in the kernel, POSIX only.
+  Waking up from a blocking receive adds tens of microseconds of
+  jitter, spinning removes it at the cost of a full core, so the
+  receiving thread should be pinned to a dedicated core (see
+  mtsATINetFTSensor::SetReceiveThread).
+
+  For each datagram, the socket is polled in a tight loop for
+  spinTime seconds, then with sched_yield between reads for yieldTime
+  seconds (lets other threads on the same core run), then the
+  transport blocks until the timeout.  With the default budgets the
+  thread never blocks at 1 kHz or more.  SO_BUSY_POLL is also set on
+  the socket if supported (Linux, value in microseconds, may require
+  CAP_NET_ADMIN) so the kernel polls the device queue during reads.
+
+  Time spent spinning, yielding and decoding datagrams (productive,
+  from ReceiveDatagram to ReleaseDatagram) is accumulated in atomic
+  counters, GetTimes can be called from any thread as long as the
+  owner of the transport doesn't delete it meanwhile. */
+class CISST_EXPORT mtsATINetFTTransportBusyPoll: public mtsATINetFTTransport
+{
+public:
+    mtsATINetFTTransportBusyPoll(osaSocket & socket,
+                                 const double spinTime = 1.0,
+                                 const double yieldTime = 0.0,
+                                 const int socketBusyPoll = 50);
+
+    bool Open(std::string & errorMessage);
+
+    inline void Close(void) {}
+
+    inline const char * GetName(void) const {
+        return "busy-poll";
+    }
+
+    int ReceiveDatagram(const char * & datagram, const double timeout);
+
+    inline void ReleaseDatagram(void) {
+        ProductiveTime.fetch_add(Now() - ReceivedTime, std::memory_order_relaxed);
+        NumberOfPackets.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /*! Accumulated times in seconds since Open. */
+    struct Times {
+        double Spinning;
+        double Yielding;
+        double Productive;
+        size_t Packets;
+    };
+    void GetTimes(Times & times) const;
+
+protected:
+    static inline unsigned long long Now(void) {
+        timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<unsigned long long>(now.tv_sec) * 1000000000ULL + now.tv_nsec;
+    }
+
+    osaSocket & Socket;
+    double SpinTime;
+    double YieldTime;
+    int SocketBusyPoll;
+    unsigned long long ReceivedTime;
+    char Buffer[512];
+
+    // nanoseconds, written by the receiving thread only
+    std::atomic<unsigned long long> SpinningTime;
+    std::atomic<unsigned long long> YieldingTime;
+    std::atomic<unsigned long long> ProductiveTime;
+    std::atomic<size_t> NumberOfPackets;
+};
+
+#endif // _mtsATINetFTTransportBusyPoll_h
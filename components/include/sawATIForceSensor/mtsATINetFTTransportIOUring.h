@@ -0,0 +1,87 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTTransportIOUring_h
+#define _mtsATINetFTTransportIOUring_h
+
+#include <vector>
+
+#include <sawATIForceSensor/mtsATINetFTTransport.h>
+
+// liburing types, only used in the implementation
+struct io_uring;
+struct io_uring_buf_ring;
+struct io_uring_cqe;
+
+// Always include last
+#include <sawATIForceSensor/sawATIForceSensorExport.h>
+
+/*! Linux io_uring transport, only compiled if liburing is found
+  (see sawATIForceSensor_HAS_IO_URING in sawATIForceSensorConfig.h).
+
+  A single multishot receive is armed on the socket and the kernel
+  picks buffers from a ring of provided buffers registered with
+  io_uring, so there is no system call per datagram: completions
+  already posted are reaped from the shared completion queue and the
+  ring is only entered when it is empty.  Datagrams are decoded in
+  place and buffers are handed back to the kernel in
+  ReleaseDatagram.  Requires Linux 6.0 or higher, Open fails on older
+  kernels and the sensor component falls back to
+  mtsATINetFTTransportSocket.  The ring is created by the first call
+  to ReceiveDatagram so it belongs to the receiving thread. */
+class CISST_EXPORT mtsATINetFTTransportIOUring: public mtsATINetFTTransport
+{
+public:
+    mtsATINetFTTransportIOUring(osaSocket & socket,
+                                const unsigned int numberOfBuffers = 256);
+    ~mtsATINetFTTransportIOUring();
+
+    bool Open(std::string & errorMessage);
+    void Close(void);
+    int ReceiveDatagram(const char * & datagram, const double timeout);
+    void ReleaseDatagram(void);
+
+    inline const char * GetName(void) const {
+        return "io_uring";
+    }
+
+    /*! Number of times the multishot receive had to be re-armed,
+      either by the kernel or because all buffers were in use. */
+    inline size_t GetNumberOfRearms(void) const {
+        return NumberOfRearms;
+    }
+
+protected:
+    /*! Create ring, register buffers and arm the receive. */
+    bool Setup(std::string & errorMessage);
+    bool ArmReceive(void);
+    /*! Return buffer to the kernel and mark completion as seen. */
+    void Recycle(io_uring_cqe * cqe);
+
+    osaSocket & Socket;
+    io_uring * Ring;
+    io_uring_buf_ring * BufferRing;
+    unsigned int NumberOfBuffers;
+    std::vector<char> Buffers;
+    bool Armed;
+    // completion of the datagram being decoded, if any
+    io_uring_cqe * Current;
+    size_t NumberOfRearms;
+};
+
+#endif // _mtsATINetFTTransportIOUring_h
@@ -0,0 +1,177 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _mtsATINetFTWatchdog_h
+#define _mtsATINetFTWatchdog_h
+
+#include <cmath>
+#include <stddef.h>
+
+/*! Stall detection based on the interval between samples learned
+  from the stream.  The expected interval and its jitter (mean
+  absolute deviation) are exponential averages of the intervals
+  between samples received.  The stream is stalled when no sample is
+  received for MissedIntervals expected intervals plus 4 times the
+  jitter.  Nothing is detected until LEARNING_SAMPLES intervals are
+  averaged.  Once learned, intervals longer than 4 expected intervals
+  are gaps and not averaged, unless RELEARN_SAMPLES consecutive gaps
+  agree with each other: the sensor rate dropped and the interval is
+  learned again from these gaps.  Times are in seconds, not thread
+  safe. */
+class mtsATINetFTWatchdog
+{
+public:
+    enum {LEARNING_SAMPLES = 32,
+          RELEARN_SAMPLES = 8};
+
+    inline mtsATINetFTWatchdog(void):
+        MissedIntervals(3.0)
+    {
+        Reset();
+    }
+
+    /*! Number of expected intervals without sample before the stream
+      is considered stalled, 0 to disable. */
+    inline void SetMissedIntervals(const double missedIntervals) {
+        MissedIntervals = missedIntervals;
+    }
+
+    inline double GetMissedIntervals(void) const {
+        return MissedIntervals;
+    }
+
+    /*! Forget the interval learned, e.g. when the sensor reconnects. */
+    inline void Reset(void) {
+        HasSample = false;
+        LastTime = 0.0;
+        Interval = 0.0;
+        Deviation = 0.0;
+        NumberOfIntervals = 0;
+        NumberOfGaps = 0;
+        GapInterval = 0.0;
+        GapDeviation = 0.0;
+        Stalled = false;
+    }
+
+    /*! Sample received at time, returns true if this ends a stall. */
+    inline bool Sample(const double time) {
+        if (!HasSample) {
+            HasSample = true;
+            LastTime = time;
+            return ClearStall();
+        }
+        const double interval = time - LastTime;
+        LastTime = time;
+        if (interval <= 0.0) {
+            return ClearStall();
+        }
+        // ignore gaps (e.g. stalls) once learned, they're not the sensor rate
+        if ((NumberOfIntervals >= LEARNING_SAMPLES) && (interval >= 4.0 * Interval)) {
+            // consecutive gaps of the same length, the rate dropped
+            if ((NumberOfGaps > 0) && (std::fabs(interval - GapInterval) > 0.25 * GapInterval)) {
+                NumberOfGaps = 0;
+            }
+            const double alpha = 1.0 / (NumberOfGaps + 1);
+            GapInterval += alpha * (interval - GapInterval);
+            GapDeviation += alpha * (std::fabs(interval - GapInterval) - GapDeviation);
+            ++NumberOfGaps;
+            if (NumberOfGaps >= RELEARN_SAMPLES) {
+                // learn again, starting from the gaps averaged
+                Interval = GapInterval;
+                Deviation = GapDeviation;
+                NumberOfIntervals = NumberOfGaps;
+                NumberOfGaps = 0;
+            }
+            return ClearStall();
+        }
+        NumberOfGaps = 0;
+        const double alpha = (NumberOfIntervals < LEARNING_SAMPLES) ?
+            1.0 / (NumberOfIntervals + 1) : 1.0 / LEARNING_SAMPLES;
+        Interval += alpha * (interval - Interval);
+        Deviation += alpha * (std::fabs(interval - Interval) - Deviation);
+        ++NumberOfIntervals;
+        return ClearStall();
+    }
+
+    inline bool IsEnabled(void) const {
+        return MissedIntervals > 0.0;
+    }
+
+    inline bool IsLearned(void) const {
+        return NumberOfIntervals >= LEARNING_SAMPLES;
+    }
+
+    inline double GetExpectedInterval(void) const {
+        return Interval;
+    }
+
+    /*! Time without sample after which the stream is stalled. */
+    inline double GetThreshold(void) const {
+        return MissedIntervals * Interval + 4.0 * Deviation;
+    }
+
+    /*! Time at which the stream will be stalled if no sample is
+      received, a negative value if not armed (disabled, learning or
+      already stalled). */
+    inline double GetDeadline(void) const {
+        if (!IsEnabled() || !IsLearned() || Stalled) {
+            return -1.0;
+        }
+        return LastTime + GetThreshold();
+    }
+
+    /*! Returns true when the stream becomes stalled. */
+    inline bool Check(const double now) {
+        const double deadline = GetDeadline();
+        if ((deadline < 0.0) || (now < deadline)) {
+            return false;
+        }
+        Stalled = true;
+        return true;
+    }
+
+    inline bool IsStalled(void) const {
+        return Stalled;
+    }
+
+    /*! Time of the last sample received. */
+    inline double GetLastTime(void) const {
+        return LastTime;
+    }
+
+protected:
+    inline bool ClearStall(void) {
+        const bool wasStalled = Stalled;
+        Stalled = false;
+        return wasStalled;
+    }
+
+    double MissedIntervals;
+    bool HasSample;
+    double LastTime;
+    double Interval;
+    double Deviation;
+    size_t NumberOfIntervals;
+    // consecutive gaps, average and deviation
+    size_t NumberOfGaps;
+    double GapInterval;
+    double GapDeviation;
+    bool Stalled;
+};
+
+#endif // _mtsATINetFTWatchdog_h
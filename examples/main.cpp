@@ -41,10 +41,11 @@ int main(int argc, char ** argv)
     std::string ftip = "192.168.1.8";
     int customPort = 0;
     double socketTimeout = 10 * cmn_ms;
+    std::string sharedMemory = "";
     std::list<std::string> managerConfig;
 
     options.AddOptionOneValue("c", "configuration",
-                              "XML configuration file",
+                              "JSON configuration file or XML calibration file",
                               cmnCommandLineOptions::OPTIONAL_OPTION, &configFile);
     options.AddOptionOneValue("i", "ftip",
                               "Force sensor IP address",
@@ -55,6 +56,9 @@ int main(int argc, char ** argv)
     options.AddOptionOneValue("t", "timeout",
                               "Socket send/receive timeout",
                               cmnCommandLineOptions::OPTIONAL_OPTION, &socketTimeout);
+    options.AddOptionOneValue("s", "shared-memory",
+                              "Name of POSIX shared memory to publish all samples (e.g. atinetft)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &sharedMemory);
     options.AddOptionMultipleValues("m", "component-manager",
                                     "JSON files to configure component manager",
                                     cmnCommandLineOptions::OPTIONAL_OPTION, &managerConfig);
@@ -81,6 +85,9 @@ int main(int argc, char ** argv)
     } else {
         forceSensor->Configure(configFile, socketTimeout);
     }
+    if (!sharedMemory.empty()) {
+        forceSensor->SetSharedMemory(sharedMemory);
+    }
     componentManager->AddComponent(forceSensor);
 
     // create a Qt user interface
@@ -95,6 +102,12 @@ int main(int argc, char ** argv)
     componentManager->Connect("ATINetFTGUI", "RequiresATINetFTSensor",
                               "ForceSensor", "ProvidesATINetFTSensor");
 
+    // custom user components
+    if (!componentManager->ConfigureJSON(managerConfig)) {
+        CMN_LOG_INIT_ERROR << "Configure: failed to configure component-manager, check cisstLog for error messages" << std::endl;
+        return -1;
+    }
+
     // create and start all components
     componentManager->CreateAllAndWait(5.0 * cmn_s);
     componentManager->StartAllAndWait(5.0 * cmn_s);
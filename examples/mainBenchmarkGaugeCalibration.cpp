@@ -0,0 +1,114 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+// Per sample cost of the raw gauge calibration, fixed size kernel
+// used in the acquisition loop vs. generic dynamic matrix product.
+
+#include <cstdlib>
+#include <iostream>
+
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstOSAbstraction/osaStopwatch.h>
+#include <cisstVector/vctDynamicMatrixTypes.h>
+#include <cisstVector/vctDynamicVectorTypes.h>
+
+#include <sawATIForceSensor/mtsATINetFTConfig.h>
+#include <sawATIForceSensor/mtsATINetFTGaugeCalibration.h>
+
+int main(int argc, char * argv[])
+{
+    cmnCommandLineOptions options;
+    std::string calibrationFile;
+    int iterations = 10000000;
+    options.AddOptionOneValue("c", "calibration",
+                              "ATI XML calibration file, use a sample matrix if not specified",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &calibrationFile);
+    options.AddOptionOneValue("n", "iterations",
+                              "number of samples converted",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &iterations);
+    if (!options.Parse(argc, argv, std::cerr)) {
+        return -1;
+    }
+
+    mtsATINetFTConfig config;
+    mtsATINetFTGaugeCalibration calibration;
+    if (!calibrationFile.empty()) {
+        if (!config.LoadCalibrationFile(calibrationFile) || !calibration.Set(config)) {
+            std::cerr << "Failed to load calibration from " << calibrationFile << std::endl;
+            return -1;
+        }
+    } else {
+        // from share/FT15360Net.xml
+        const double matrix[36] = {
+            0.95857780328592, -7.09068706761282, -12.5657784901282, -1046.8950875624, 21.8927365667687, 1036.45521101825,
+            -2.89495868490779, 1192.35612501503, 5.25377668003315, -600.209928609825, -31.4930517297852, -595.344473961408,
+            1159.38653166712, 18.5363616071962, 1150.09567222567, -15.2747462211077, 1157.12154186474, -26.6515203941131,
+            -24.4444142189613, 7273.44809457732, 6353.74010398814, -3742.44740124928, -6707.95576997697, -3487.23984308376,
+            -7479.20133269296, -81.8308524762279, 3779.06601877492, 6342.02797122289, 3581.25510615785, -6402.35505364939,
+            -47.5972236012824, 4252.62036785841, 115.886846183419, 4323.37916388102, 72.5601551347998, 4197.04204771048};
+        const double offsets[6] = {26604, 33612, 19660, 38416, 29470, 44414};
+        calibration.Set(matrix, offsets, 1000000.0, 1000000.0);
+        config.CalibInfo.Matrix.SetSize(6, 6);
+        for (size_t row = 0; row < 6; ++row) {
+            for (size_t column = 0; column < 6; ++column) {
+                config.CalibInfo.Matrix.Element(row, column) = matrix[row * 6 + column] / 1000000.0;
+            }
+            config.CalibInfo.GaugeOffsets[row] = offsets[row];
+        }
+    }
+
+    // pre-generate gauge values so the benchmark doesn't measure rand()
+    const size_t numberOfGauges = 1024;
+    double gauges[numberOfGauges][6];
+    for (size_t i = 0; i < numberOfGauges; ++i) {
+        for (size_t axis = 0; axis < 6; ++axis) {
+            gauges[i][axis] = 32768.0 + (std::rand() % 4000) - 2000.0;
+        }
+    }
+
+    osaStopwatch stopwatch;
+    double forceTorque[6];
+    double checksum = 0.0;
+    stopwatch.Start();
+    for (int i = 0; i < iterations; ++i) {
+        calibration.Apply(gauges[i % numberOfGauges], forceTorque);
+        checksum += forceTorque[2];
+    }
+    stopwatch.Stop();
+    const double fixedTime = stopwatch.GetElapsedTime() / iterations;
+
+    // generic code often found in consumers, allocates for each sample
+    vctDoubleVec offsets(6);
+    offsets.Assign(config.CalibInfo.GaugeOffsets.Pointer());
+    stopwatch.Reset();
+    stopwatch.Start();
+    for (int i = 0; i < iterations; ++i) {
+        vctDoubleVec gauge(6);
+        gauge.Assign(gauges[i % numberOfGauges]);
+        const vctDoubleVec result = config.CalibInfo.Matrix * (gauge - offsets);
+        checksum += result[2];
+    }
+    stopwatch.Stop();
+    const double dynamicTime = stopwatch.GetElapsedTime() / iterations;
+
+    std::cout << "Samples converted: " << iterations << std::endl
+              << "Fixed size kernel: " << fixedTime * 1.0e9 << " ns per sample" << std::endl
+              << "Dynamic matrix:    " << dynamicTime * 1.0e9 << " ns per sample" << std::endl
+              << "(checksum " << checksum << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,229 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+// CPU used per sample by the receive backends (osaSocket and
+// io_uring) with several simulated sensors streaming RDT packets on
+// the loopback interface at 1 kHz and 7 kHz.  One receive thread per
+// sensor, like one sensor component per sensor.  Linux only.
+
+#include <arpa/inet.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstOSAbstraction/osaSocket.h>
+#include <cisstOSAbstraction/osaThread.h>
+
+#include <sawATIForceSensor/sawATIForceSensorConfig.h>
+#include <sawATIForceSensor/mtsATINetFTSource.h>
+#include <sawATIForceSensor/mtsATINetFTTransport.h>
+#if sawATIForceSensor_HAS_IO_URING
+#include <sawATIForceSensor/mtsATINetFTTransportIOUring.h>
+#endif
+
+namespace {
+    double ThreadCPUTime(void)
+    {
+        timespec now;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+        return now.tv_sec + now.tv_nsec * 1.0e-9;
+    }
+}
+
+class SensorReceiver
+{
+public:
+    SensorReceiver(const std::string & backend, const unsigned short port):
+        Socket(osaSocket::UDP),
+        Receiver(0),
+        Running(false),
+        NumberOfSamples(0),
+        CPUTime(0.0)
+    {
+        Socket.AssignPort(port);
+#if sawATIForceSensor_HAS_IO_URING
+        if (backend == "io_uring") {
+            Receiver = new mtsATINetFTSource<mtsATINetFTTransportIOUring, mtsATINetFTProtocolRDT>(Socket);
+        }
+#endif
+        if (!Receiver) {
+            Receiver = new mtsATINetFTSource<mtsATINetFTTransportSocket, mtsATINetFTProtocolRDT>(Socket);
+        }
+    }
+
+    ~SensorReceiver() {
+        delete Receiver;
+        Socket.Close();
+    }
+
+    bool Start(std::string & errorMessage) {
+        if (!Receiver->Open(errorMessage)) {
+            return false;
+        }
+        Running = true;
+        Thread.Create<SensorReceiver, int>(this, &SensorReceiver::Loop, 0, "ATIBench");
+        return true;
+    }
+
+    void Stop(void) {
+        Running = false;
+        Thread.Wait();
+        Receiver->Close();
+    }
+
+    void * Loop(int) {
+        mtsATINetFTPacket packet;
+        const double start = ThreadCPUTime();
+        while (Running) {
+            if (Receiver->Receive(packet, 0.05)) {
+                ++NumberOfSamples;
+            }
+        }
+        CPUTime = ThreadCPUTime() - start;
+        return 0;
+    }
+
+    osaSocket Socket;
+    mtsATINetFTReceiver * Receiver;
+    osaThread Thread;
+    std::atomic<bool> Running;
+    size_t NumberOfSamples;
+    double CPUTime;
+};
+
+bool RunBenchmark(const std::string & backend, const double rate,
+                  const int numberOfSensors, const double duration,
+                  const unsigned short basePort)
+{
+    std::vector<SensorReceiver *> receivers;
+    std::vector<osaSocket *> senders;
+    for (int i = 0; i < numberOfSensors; ++i) {
+        const unsigned short port = static_cast<unsigned short>(basePort + i);
+        SensorReceiver * receiver = new SensorReceiver(backend, port);
+        std::string errorMessage;
+        if (!receiver->Start(errorMessage)) {
+            std::cerr << backend << ": failed to start receiver, " << errorMessage << std::endl;
+            delete receiver;
+            break;
+        }
+        receivers.push_back(receiver);
+        osaSocket * sender = new osaSocket(osaSocket::UDP);
+        sender->SetDestination("127.0.0.1", port);
+        senders.push_back(sender);
+    }
+
+    bool result = (static_cast<int>(receivers.size()) == numberOfSensors);
+    size_t numberOfSent = 0;
+    if (result) {
+        // RDT packet, see section 9.1 of the Net F/T user manual
+        char packet[36];
+        memset(packet, 0, sizeof(packet));
+        const long period = static_cast<long>(1.0e9 / rate);
+        const size_t numberOfPackets = static_cast<size_t>(duration * rate);
+        timespec next;
+        clock_gettime(CLOCK_MONOTONIC, &next);
+        for (size_t sequence = 0; sequence < numberOfPackets; ++sequence) {
+            const uint32_t word = htonl(static_cast<uint32_t>(sequence));
+            memcpy(packet, &word, 4);
+            for (size_t i = 0; i < senders.size(); ++i) {
+                if (senders[i]->Send(packet, sizeof(packet)) == sizeof(packet)) {
+                    ++numberOfSent;
+                }
+            }
+            next.tv_nsec += period;
+            while (next.tv_nsec >= 1000000000) {
+                next.tv_nsec -= 1000000000;
+                ++next.tv_sec;
+            }
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, 0);
+        }
+    }
+
+    size_t numberOfReceived = 0;
+    double cpuTime = 0.0;
+    for (size_t i = 0; i < receivers.size(); ++i) {
+        receivers[i]->Stop();
+        numberOfReceived += receivers[i]->NumberOfSamples;
+        cpuTime += receivers[i]->CPUTime;
+        delete receivers[i];
+        delete senders[i];
+    }
+
+    if (result) {
+        std::cout << std::setw(10) << backend
+                  << std::setw(8) << static_cast<int>(rate)
+                  << std::setw(9) << numberOfSensors
+                  << std::setw(10) << numberOfSent
+                  << std::setw(10) << numberOfReceived
+                  << std::setw(14) << std::fixed << std::setprecision(2)
+                  << ((numberOfReceived > 0) ? 1.0e6 * cpuTime / numberOfReceived : 0.0)
+                  << std::setw(12) << 100.0 * cpuTime / duration
+                  << std::endl;
+    }
+    return result;
+}
+
+int main(int argc, char * argv[])
+{
+    cmnCommandLineOptions options;
+    int numberOfSensors = 4;
+    double duration = 5.0;
+    int basePort = 50000;
+    options.AddOptionOneValue("s", "sensors",
+                              "number of simulated sensors",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &numberOfSensors);
+    options.AddOptionOneValue("d", "duration",
+                              "duration of each run in seconds",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &duration);
+    options.AddOptionOneValue("p", "port",
+                              "first UDP port used, one per sensor",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &basePort);
+    if (!options.Parse(argc, argv, std::cerr)) {
+        return -1;
+    }
+
+    std::vector<std::string> backends;
+    backends.push_back("osaSocket");
+#if sawATIForceSensor_HAS_IO_URING
+    backends.push_back("io_uring");
+#else
+    std::cout << "Compiled without io_uring backend, only osaSocket is measured" << std::endl;
+#endif
+    const double rates[] = {1000.0, 7000.0};
+
+    std::cout << std::setw(10) << "backend"
+              << std::setw(8) << "rate"
+              << std::setw(9) << "sensors"
+              << std::setw(10) << "sent"
+              << std::setw(10) << "received"
+              << std::setw(14) << "CPU us/sample"
+              << std::setw(12) << "CPU % core" << std::endl;
+    for (size_t b = 0; b < backends.size(); ++b) {
+        for (size_t r = 0; r < 2; ++r) {
+            RunBenchmark(backends[b], rates[r], numberOfSensors, duration,
+                         static_cast<unsigned short>(basePort));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,173 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+// Offline check of the clock model: synthetic streams with a known
+// period, drift and jitter, late packets, restarts and sequence wrap
+// around.  Returns 0 if all checks pass.
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <sawATIForceSensor/mtsATINetFTClockModel.h>
+
+namespace {
+
+    int NumberOfFailures = 0;
+
+    void Check(const bool condition, const std::string & description)
+    {
+        std::cout << (condition ? "  ok:     " : "  FAILED: ") << description << std::endl;
+        if (!condition) {
+            ++NumberOfFailures;
+        }
+    }
+
+    // sensor at rate Hz, host clock drifting by drift (relative),
+    // receive time delayed by 0 to jitter seconds and every lateEvery
+    // packets by late seconds more
+    struct Stream {
+        double Period;
+        double Jitter;
+        size_t LateEvery;
+        double Late;
+        std::mt19937 Generator;
+        std::uniform_real_distribution<double> Delay;
+
+        Stream(const double rate, const double drift, const double jitter,
+               const size_t lateEvery = 0, const double late = 0.0):
+            Period((1.0 + drift) / rate),
+            Jitter(jitter),
+            LateEvery(lateEvery),
+            Late(late),
+            Generator(1234),
+            Delay(0.0, jitter)
+        {}
+
+        // time the sample was acquired, in host time
+        inline double Acquisition(const size_t index) const {
+            return 1.0 + index * Period;
+        }
+
+        inline double Receive(const size_t index) {
+            double time = Acquisition(index) + Delay(Generator);
+            if ((LateEvery != 0) && (index % LateEvery == LateEvery - 1)) {
+                time += Late;
+            }
+            return time;
+        }
+    };
+
+    void CheckPeriodAndJitter(void)
+    {
+        std::cout << "7 kHz, +50 ppm drift, 20 us jitter, 1 in 100 packets 500 us late" << std::endl;
+        Stream stream(7000.0, 50.0e-6, 20.0e-6, 100, 500.0e-6);
+        mtsATINetFTClockModel model;
+        const size_t numberOfSamples = 70000;
+        double maxError = 0.0;
+        for (size_t index = 0; index < numberOfSamples; ++index) {
+            const double time = model.Update(static_cast<uint32_t>(index), stream.Receive(index));
+            // fitted line goes through the mean delay, half the jitter
+            if (index > numberOfSamples / 2) {
+                const double error = std::fabs(time - stream.Acquisition(index) - 0.5 * stream.Jitter);
+                if (error > maxError) {
+                    maxError = error;
+                }
+            }
+        }
+        const double periodError = std::fabs(model.GetPeriod() - stream.Period) / stream.Period;
+        // RMS of a uniform distribution over [0, jitter]
+        const double expectedJitter = stream.Jitter / std::sqrt(12.0);
+        std::cout << "  period " << model.GetPeriod() << " s (relative error " << periodError
+                  << "), jitter " << model.GetJitter() << " s (expected " << expectedJitter
+                  << "), max time error " << maxError << " s, late packets "
+                  << model.GetNumberOfLatePackets() << std::endl;
+        Check(model.IsLocked(), "model locked");
+        Check(periodError < 1.0e-6, "period within 1 ppm, drift tracked");
+        Check(std::fabs(model.GetJitter() - expectedJitter) < 0.2 * expectedJitter,
+              "jitter within 20% of the RMS delay");
+        Check(maxError < 5.0e-6, "de-jittered time within 5 us, late packets included");
+        Check(model.GetNumberOfLatePackets() == numberOfSamples / 100,
+              "all late packets detected and none other");
+        Check(model.GetNumberOfResets() == 0, "no restart");
+    }
+
+    void CheckRestarts(void)
+    {
+        std::cout << "restarts: sequence backward, sequence jump, receive time jump" << std::endl;
+        Stream stream(1000.0, 0.0, 10.0e-6);
+        mtsATINetFTClockModel model;
+        size_t index = 0;
+        for (; index < 1000; ++index) {
+            model.Update(static_cast<uint32_t>(index), stream.Receive(index));
+        }
+        Check(model.IsLocked(), "model locked");
+        // new streaming request, sequence starts over
+        model.Update(0, stream.Receive(index));
+        Check(!model.IsLocked() && (model.GetNumberOfResets() == 1), "restart when sequence goes backward");
+        Check(model.GetPeriod() == 0.0, "no period until locked again");
+        for (size_t sequence = 1; sequence < 1000; ++sequence) {
+            ++index;
+            model.Update(static_cast<uint32_t>(sequence), stream.Receive(index));
+        }
+        Check(model.IsLocked(), "locked again");
+        ++index;
+        model.Update(1000 + 100000, stream.Receive(index));
+        Check(!model.IsLocked() && (model.GetNumberOfResets() == 2), "restart when sequence jumps");
+        for (size_t sequence = 1; sequence < 1000; ++sequence) {
+            ++index;
+            model.Update(static_cast<uint32_t>(101000 + sequence), stream.Receive(index));
+        }
+        Check(model.IsLocked(), "locked again");
+        // host clock stepped by 1 s
+        ++index;
+        model.Update(102000, stream.Receive(index) + 1.0);
+        Check(!model.IsLocked() && (model.GetNumberOfResets() == 3), "restart when receive time jumps");
+        model.Reset();
+        Check(!model.IsLocked() && (model.GetNumberOfResets() == 3), "Reset forgets samples, not counted");
+    }
+
+    void CheckWrapAround(void)
+    {
+        std::cout << "sequence wrap around" << std::endl;
+        Stream stream(7000.0, -30.0e-6, 20.0e-6);
+        mtsATINetFTClockModel model;
+        const uint32_t first = 0xFFFFFFFFu - 10000u;
+        for (size_t index = 0; index < 20000; ++index) {
+            model.Update(first + static_cast<uint32_t>(index), stream.Receive(index));
+        }
+        const double periodError = std::fabs(model.GetPeriod() - stream.Period) / stream.Period;
+        Check(model.IsLocked() && (model.GetNumberOfResets() == 0), "no restart at wrap around");
+        Check(periodError < 1.0e-5, "period within 10 ppm");
+    }
+}
+
+int main(void)
+{
+    CheckPeriodAndJitter();
+    CheckRestarts();
+    CheckWrapAround();
+    if (NumberOfFailures != 0) {
+        std::cout << NumberOfFailures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}
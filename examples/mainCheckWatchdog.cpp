@@ -0,0 +1,155 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+// Offline check of the stall watchdog: learning, stalls, rate changes
+// and Reset on synthetic sample times.  Returns 0 if all checks pass.
+
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <sawATIForceSensor/mtsATINetFTWatchdog.h>
+
+namespace {
+
+    int NumberOfFailures = 0;
+
+    void Check(const bool condition, const std::string & description)
+    {
+        std::cout << (condition ? "  ok:     " : "  FAILED: ") << description << std::endl;
+        if (!condition) {
+            ++NumberOfFailures;
+        }
+    }
+
+    // samples at rate Hz with uniform jitter, the watchdog is checked
+    // right before each sample is received (worst case)
+    struct Stream {
+        double Time;
+        std::mt19937 Generator;
+        std::uniform_real_distribution<double> Jitter;
+        size_t NumberOfStalls;
+
+        Stream(void):
+            Time(1.0),
+            Generator(1234),
+            Jitter(-0.1, 0.1),
+            NumberOfStalls(0)
+        {}
+
+        void Run(mtsATINetFTWatchdog & watchdog, const double rate, const size_t numberOfSamples) {
+            for (size_t index = 0; index < numberOfSamples; ++index) {
+                const double next = Time + (1.0 + Jitter(Generator)) / rate;
+                if (watchdog.Check(next - 1.0e-9)) {
+                    ++NumberOfStalls;
+                }
+                Time = next;
+                watchdog.Sample(Time);
+            }
+        }
+    };
+
+    inline bool Near(const double value, const double expected, const double tolerance) {
+        return (value > expected * (1.0 - tolerance)) && (value < expected * (1.0 + tolerance));
+    }
+
+    void CheckLearningAndStall(void)
+    {
+        std::cout << "1 kHz, learning then stall" << std::endl;
+        mtsATINetFTWatchdog watchdog;
+        Stream stream;
+        stream.Run(watchdog, 1000.0, mtsATINetFTWatchdog::LEARNING_SAMPLES - 1);
+        Check(!watchdog.IsLearned() && (watchdog.GetDeadline() < 0.0), "not armed while learning");
+        Check(!watchdog.Check(stream.Time + 1.0), "no stall while learning");
+        stream.Run(watchdog, 1000.0, 1000);
+        Check(watchdog.IsLearned() && Near(watchdog.GetExpectedInterval(), 1.0e-3, 0.05),
+              "interval learned within 5%");
+        Check(stream.NumberOfStalls == 0, "no stall while streaming");
+        const double threshold = watchdog.GetThreshold();
+        Check((threshold > 3.0e-3) && (threshold < 4.0e-3), "threshold 3 intervals plus jitter margin");
+        Check(!watchdog.Check(stream.Time + 0.99 * threshold), "no stall before the threshold");
+        Check(watchdog.Check(stream.Time + threshold), "stall at the threshold");
+        Check(watchdog.IsStalled() && (watchdog.GetDeadline() < 0.0), "stalled, not armed");
+        Check(!watchdog.Check(stream.Time + 1.0), "stall reported once");
+        Check(watchdog.Sample(stream.Time + 1.0), "sample ends the stall");
+        stream.Time += 1.0;
+        Check(Near(watchdog.GetExpectedInterval(), 1.0e-3, 0.05), "gap not learned as interval");
+        stream.Run(watchdog, 1000.0, 1000);
+        Check(stream.NumberOfStalls == 0, "no stall after recovery");
+    }
+
+    void CheckRateChanges(void)
+    {
+        std::cout << "rate changes, 1 kHz to 7 kHz to 1 kHz to 500 Hz" << std::endl;
+        mtsATINetFTWatchdog watchdog;
+        Stream stream;
+        stream.Run(watchdog, 1000.0, 1000);
+        stream.Run(watchdog, 7000.0, 1000);
+        Check(Near(watchdog.GetExpectedInterval(), 1.0 / 7000.0, 0.05), "faster rate learned");
+        // 7x slower: the first intervals are gaps and stall, the rate
+        // is learned again from RELEARN_SAMPLES consecutive gaps
+        stream.Run(watchdog, 1000.0, 1000);
+        Check(Near(watchdog.GetExpectedInterval(), 1.0e-3, 0.05), "7x slower learned without Reset");
+        Check(stream.NumberOfStalls <= mtsATINetFTWatchdog::RELEARN_SAMPLES,
+              "stalls only until the slower rate is learned");
+        stream.NumberOfStalls = 0;
+        stream.Run(watchdog, 1000.0, 1000);
+        Check(stream.NumberOfStalls == 0, "no stall once learned");
+        // gaps of different lengths are stalls, not a new rate
+        for (size_t index = 0; index < 2 * mtsATINetFTWatchdog::RELEARN_SAMPLES; ++index) {
+            stream.Time += (index % 2) ? 10.0e-3 : 20.0e-3;
+            watchdog.Sample(stream.Time);
+        }
+        Check(Near(watchdog.GetExpectedInterval(), 1.0e-3, 0.05), "irregular gaps not learned");
+        stream.Run(watchdog, 1000.0, 1000);
+        Check(stream.NumberOfStalls == 0, "no stall after irregular gaps");
+        watchdog.Reset();
+        stream.Run(watchdog, 1000.0, 1000);
+        Check(Near(watchdog.GetExpectedInterval(), 1.0e-3, 0.05) && (stream.NumberOfStalls == 0),
+              "learned again after Reset");
+        // 2x slower: below the threshold, learned without stall
+        stream.Run(watchdog, 500.0, 1000);
+        Check(Near(watchdog.GetExpectedInterval(), 2.0e-3, 0.05), "2x slower learned without Reset");
+        Check(stream.NumberOfStalls == 0, "no stall for 2x slower");
+    }
+
+    void CheckDisabled(void)
+    {
+        std::cout << "disabled" << std::endl;
+        mtsATINetFTWatchdog watchdog;
+        watchdog.SetMissedIntervals(0.0);
+        Stream stream;
+        stream.Run(watchdog, 1000.0, 1000);
+        Check(!watchdog.IsEnabled() && (watchdog.GetDeadline() < 0.0), "not armed");
+        Check(!watchdog.Check(stream.Time + 1.0), "no stall");
+    }
+}
+
+int main(void)
+{
+    CheckLearningAndStall();
+    CheckRateChanges();
+    CheckDisabled();
+    if (NumberOfFailures != 0) {
+        std::cout << NumberOfFailures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}
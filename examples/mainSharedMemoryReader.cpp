@@ -0,0 +1,99 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  sawATIForceSensor contributors
+  Created on: 2026-10-19
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+// This example doesn't use cisst on purpose, it only links against
+// sawATIForceSensorSharedMemory to show what an out-of-process client
+// needs.
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <signal.h>
+#include <unistd.h>
+
+#include <sawATIForceSensor/mtsATINetFTSharedMemoryReader.h>
+
+static volatile sig_atomic_t keepRunning = 1;
+
+static void stopRunning(int)
+{
+    keepRunning = 0;
+}
+
+int main(int argc, char ** argv)
+{
+    std::string name = "atinetft";
+    if (argc > 1) {
+        name = argv[1];
+    }
+    if ((argc > 2) || (name == "-h") || (name == "--help")) {
+        std::cerr << "Usage: " << argv[0] << " [shared-memory-name]" << std::endl
+                  << "  shared-memory-name: name used by the force sensor component, default is \"atinetft\"" << std::endl;
+        return -1;
+    }
+
+    signal(SIGINT, stopRunning);
+
+    mtsATINetFTSharedMemoryReader reader;
+    std::string errorMessage;
+    while (keepRunning && !reader.Open(name, errorMessage)) {
+        std::cerr << "Waiting for writer: " << errorMessage << std::endl;
+        sleep(1);
+    }
+
+    // consume all samples at full rate and print a summary every second
+    const size_t bufferSize = 256;
+    mtsATINetFTSharedMemorySample samples[bufferSize];
+    uint64_t nextIndex = reader.GetWriteCount();
+    uint64_t received = 0;
+    uint64_t totalLost = 0;
+    unsigned int iteration = 0;
+
+    std::cout << std::fixed << std::setprecision(3);
+    while (keepRunning) {
+        if (!reader.IsWriterActive()) {
+            std::cerr << "Writer stopped" << std::endl;
+            break;
+        }
+        uint64_t lost;
+        received += reader.GetSince(nextIndex, samples, bufferSize, lost);
+        totalLost += lost;
+        usleep(1000);
+        ++iteration;
+        if (iteration == 1000) {
+            iteration = 0;
+            mtsATINetFTSharedMemorySample latest;
+            if (reader.GetLatest(latest)) {
+                std::cout << "samples: " << received
+                          << " lost: " << totalLost
+                          << " connected: " << reader.IsConnected()
+                          << " t: " << latest.Timestamp
+                          << " rdt: " << latest.RdtSequence
+                          << " ft: [";
+                for (size_t i = 0; i < 6; ++i) {
+                    std::cout << " " << latest.ForceTorque[i];
+                }
+                std::cout << " ]" << std::endl;
+            }
+        }
+    }
+
+    reader.Close();
+    return 0;
+}